@@ -2,6 +2,10 @@
 // Copyright (c) GPL 2024 Arkanic <https://github.com/Arkanic>
 
 #include <stdio.h> /* fprintf */
+#include <stdlib.h> /* malloc */
+#include <pthread.h>
+
+#include <assert.h>
 
 #include "lib.h"
 
@@ -36,9 +40,134 @@ void compute_constants(struct PageConstants *out, struct PageFormat *format) {
 		out->fec_smallbits = out->fec_largebits - 1 - format->fec_order;
 	}
 
-	out->fec_syms = out->totalbits / out->fec_largebits;
+	out->headerbits = HEADER_BITS;
+	if(out->totalbits < 2 * out->headerbits + out->fec_largebits) {
+		fprintf(stderr, "The page format is too small to hold the page header\n");
+		exit(1);
+	}
+
+	out->fec_syms = (out->totalbits - 2 * out->headerbits) / out->fec_largebits;
 	out->netbits = out->fec_syms * out->fec_smallbits;
 	out->usedbits = out->fec_syms * out->fec_largebits;
+	out->page_bytes = out->netbits >> 3;
+}
+
+/* Page layouts in use, each freed when its last user releases it */
+static struct PageLayout *layouts;
+static pthread_mutex_t layouts_lock = PTHREAD_MUTEX_INITIALIZER;
+
+/* Cuts the channel into runs in raster order, which is the order of sequence
+ * numbers. Every row of the data area yields one run per cell: a gap between
+ * crosses in the narrow strips, a cell width in the wide ones, where the
+ * edges belong to the outermost cells. */
+static struct PageLayout *build_layout(struct PageConstants *constants) {
+	struct PageFormat *format = constants->format;
+	unsigned int cells_across = format->xcrosses - 1;
+	struct PageLayout *layout = malloc(sizeof(*layout));
+	if(!layout) {
+		fprintf(stderr, "Cannot allocate page layout\n");
+		exit(1);
+	}
+
+	layout->xcrosses = format->xcrosses;
+	layout->ycrosses = format->ycrosses;
+	layout->cpitch = format->cpitch;
+	layout->chalf = format->chalf;
+	layout->n_runs = constants->data_height * cells_across;
+	layout->runs = malloc(sizeof(*layout->runs) * (layout->n_runs + 1));
+	if(!layout->runs) {
+		fprintf(stderr, "Cannot allocate page layout\n");
+		exit(1);
+	}
+
+	struct LayoutRun *run = layout->runs;
+	unsigned long long seq = 0;
+	for(unsigned int y = 0; y < constants->data_height; y++) {
+		/* Cell row like in bit_coord */
+		unsigned int cy = y < (unsigned)format->chalf ? 0 : (y - format->chalf) / format->cpitch;
+		if(cy > (unsigned)format->ycrosses - 2) cy = format->ycrosses - 2;
+
+		int narrow = y % format->cpitch < 2 * (unsigned)format->chalf;
+		unsigned int x = 0;
+		for(unsigned int cx = 0; cx < cells_across; cx++, run++) {
+			unsigned int end;
+
+			if(narrow) {
+				/* Only the gaps between the crosses */
+				x = cx * format->cpitch + 2 * format->chalf;
+				end = x + constants->gapwidth;
+			} else {
+				end = cx == cells_across - 1 ? constants->widewidth : (cx + 1) * format->cpitch + format->chalf;
+			}
+
+			run->seq = seq;
+			run->x = x;
+			run->y = y;
+			run->length = end - x;
+			run->cx = cx;
+			run->cy = cy;
+			seq += run->length;
+			x = end;
+		}
+	}
+	assert(seq == constants->totalbits);
+
+	/* Sentinel, so that run[1].seq always exists */
+	run->seq = seq;
+	run->length = 0;
+
+	return layout;
+}
+
+/* Returns the layout of the page, built on the first call for its geometry */
+const struct PageLayout *page_layout(struct PageConstants *constants) {
+	struct PageFormat *format = constants->format;
+	struct PageLayout *layout;
+
+	pthread_mutex_lock(&layouts_lock);
+	for(layout = layouts; layout; layout = layout->next) {
+		if(layout->xcrosses == format->xcrosses && layout->ycrosses == format->ycrosses
+			&& layout->cpitch == format->cpitch && layout->chalf == format->chalf) break;
+	}
+	if(!layout) {
+		layout = build_layout(constants);
+		layout->users = 0;
+		layout->next = layouts;
+		layouts = layout;
+	}
+	layout->users++;
+	pthread_mutex_unlock(&layouts_lock);
+
+	return layout;
+}
+
+/* Gives back a layout from page_layout(), freeing it after its last user */
+void page_layout_release(const struct PageLayout *layout) {
+	struct PageLayout **link;
+
+	pthread_mutex_lock(&layouts_lock);
+	for(link = &layouts; *link != layout; link = &(*link)->next) assert(*link);
+	struct PageLayout *found = *link;
+	if(!--found->users) {
+		*link = found->next;
+		free(found->runs);
+		free(found);
+	}
+	pthread_mutex_unlock(&layouts_lock);
+}
+
+/* Returns the run holding channel sequence number seq < totalbits */
+const struct LayoutRun *layout_find(const struct PageLayout *layout, unsigned long long seq) {
+	const struct LayoutRun *low = layout->runs, *high = layout->runs + layout->n_runs;
+
+	/* low->seq <= seq < high->seq */
+	while(high - low > 1) {
+		const struct LayoutRun *mid = low + (high - low) / 2;
+		if(mid->seq <= seq) low = mid;
+		else high = mid;
+	}
+
+	return low;
 }
 
 /* debug print */
@@ -60,16 +189,16 @@ void print_pageconstants(struct PageConstants *constants) {
 		"narrowheight: %u\ngapwidth: %u\nnarrowwidth: %lu\nnarrowpixels: %llu\n"
 		"wideheight: %u\nwidewidth: %lu\nwidepixels: %llu\n"
 		"repheight: %u\nreppixels: %llu\n"
-		"totalbits: %llu\n"
+		"totalbits: %llu\nheaderbits: %llu\n"
 		"fec_largebits: %u\nfec_smallbits: %u\n"
-		"fec_syms: %llu\nnetbits: %llu\nusedbits: %llu\n",
+		"fec_syms: %llu\nnetbits: %llu\nusedbits: %llu\npage_bytes: %lu\n",
 		constants->data_width, constants->data_height, constants->width, constants->height,
 		constants->narrowheight, constants->gapwidth, constants->narrowwidth, constants->narrowpixels,
 		constants->wideheight, constants->widewidth, constants->widepixels,
 		constants->repheight, constants->reppixels,
-		constants->totalbits,
+		constants->totalbits, constants->headerbits,
 		constants->fec_largebits, constants->fec_smallbits,
-		constants->fec_syms, constants->netbits, constants->usedbits
+		constants->fec_syms, constants->netbits, constants->usedbits, constants->page_bytes
 	);
 }
 
@@ -1,10 +1,15 @@
 /* (c) GPL 2007 Karel 'Clock' Kulhavy, Twibright Labs */
 
 #include <stdio.h>
+#include <string.h>
 #include <assert.h>
 
 #include "parity.h"
 
+/* Marks a syndrome which isn't caused by 3 or less flipped bits. Must match
+ * GOLAY_IRREPARABLE in lib.h */
+#define IRREPARABLE 0xffffffffUL
+
 int dodecahedron[12][5] = {
 	/* For each dodecahedron face (number in the comment, 1-12) there
 	 * is a list of the 5 adjacent faces (1-12). See golay.svg for
@@ -24,7 +29,52 @@ int dodecahedron[12][5] = {
 };
 
 unsigned parities[12];
+unsigned long codes[4096];
+unsigned long syndromes[4096]; /* Syndrome -> error pattern */
+
+/* The code is linear, so the syndrome of a received word is the parity part
+ * of (codeword of its data part) xor (the received word). */
+static unsigned syndrome(unsigned long word) {
+	return (codes[word >> 12] ^ word) & 0xfff;
+}
+
+/* Every error pattern of max. 3 bits has an unique syndrome (the minimum
+ * distance is 8) */
+static void add_pattern(unsigned long pattern) {
+	unsigned s = syndrome(pattern);
+	assert(syndromes[s] == IRREPARABLE);
+	syndromes[s] = pattern;
+}
+
+static void print_syndromes(void) {
+	unsigned int filled = 0;
+
+	for(int s = 0; s < 4096; s++) syndromes[s] = IRREPARABLE;
+
+	add_pattern(0);
+	for(int a = 0; a < 24; a++) {
+		add_pattern(1UL << a);
+		for(int b = a + 1; b < 24; b++) {
+			add_pattern((1UL << a) | (1UL << b));
+			for(int c = b + 1; c < 24; c++) {
+				add_pattern((1UL << a) | (1UL << b) | (1UL << c));
+			}
+		}
+	}
+
+	printf("unsigned long golay_syndromes[4096]={\n");
+	for(int s = 0; s < 4096; s++) {
+		if(syndromes[s] != IRREPARABLE) filled++;
+		printf((s == 4095 ? "0x%06lx\n" : "0x%06lx,\n"), syndromes[s]);
+	}
+	printf("};\n");
+
+	/* 1 + 24 + 276 + 2024 patterns with 0...3 bits */
+	assert(filled == 2325);
+}
 
+/* Without arguments prints golay_codes, with "syndromes" prints the syndrome
+ * decoding table golay_syndromes */
 int main(int argc, char *argv[]) {
 
 	for(int p=0; p < 12; p++) {
@@ -33,8 +83,6 @@ int main(int argc, char *argv[]) {
 		parities[p] = mask;
 	}
 
-	printf("unsigned long golay_codes[4096]={\n");
-
 	for (unsigned int input = 0; input < 4096; input++) {
 
 		unsigned int prty = 0; // parity
@@ -45,7 +93,7 @@ int main(int argc, char *argv[]) {
 
 		unsigned long codeword = ((unsigned long)input << 12) | prty;
 		unsigned int n_ones = ones(codeword);
-		printf((input == 4095 ? "0x%06lx\n" : "0x%06lx,\n"), codeword);
+		codes[input] = codeword;
 
 		assert(n_ones == 0
 			 ||n_ones == 8
@@ -54,6 +102,15 @@ int main(int argc, char *argv[]) {
 			 ||n_ones == 24);
 	}
 
+	if(argc > 1 && !strcmp(argv[1], "syndromes")) {
+		print_syndromes();
+		return 0;
+	}
+
+	printf("unsigned long golay_codes[4096]={\n");
+	for (unsigned int input = 0; input < 4096; input++) {
+		printf((input == 4095 ? "0x%06lx\n" : "0x%06lx,\n"), codes[input]);
+	}
 	printf("};\n");
 	
 	return 0;
@@ -0,0 +1,148 @@
+// Copyright (c) GPL 2024 Arkanic <https://github.com/Arkanic>
+
+/* Extended Hamming codes of fec_order 2 to 5, 2^fec_order bits long. Bit n of
+ * a codeword is position n: the data bits fill the positions which aren't a
+ * power of two from 3 on, LSB first, position 2^j is the check bit of the
+ * positions with bit j set and position 0 makes the parity of the whole word
+ * even.
+ *
+ * Everything goes through tables indexed by one byte of a word, so a symbol
+ * takes a handful of loads and XORs and no branches. The data bits land on
+ * the same positions whatever the order, so the tables are shared and the
+ * kernels only differ in how many bytes they look at. */
+
+#include <stdlib.h>
+#include <pthread.h>
+
+#include "lib.h"
+
+/* Data byte k -> its bits spread to their codeword positions */
+static unsigned long spread[4][256];
+/* Codeword byte k -> XOR of the positions of its ones, and in bit 5 the
+ * parity of them. For a whole word that's its syndrome and parity. */
+static unsigned char syndrome[4][256];
+/* Syndrome and parity of the spread data -> check bits and position 0 */
+static unsigned long checks[64];
+/* Codeword byte k -> the data bits in it */
+static unsigned long gather[4][256];
+
+static pthread_once_t tables_once = PTHREAD_ONCE_INIT;
+
+static void make_tables(void) {
+	unsigned int position[32]; /* Of data bit n */
+	unsigned int n = 0;
+
+	for(unsigned int pos = 3; pos < 32; pos++) {
+		if(pos & (pos - 1)) position[n++] = pos;
+	}
+
+	for(unsigned int k = 0; k < 4; k++) {
+		for(unsigned int byte = 0; byte < 256; byte++) {
+			unsigned int syn = 0;
+
+			spread[k][byte] = 0;
+			gather[k][byte] = 0;
+			for(unsigned int bit = 0; bit < 8; bit++) {
+				unsigned int pos = 8 * k + bit;
+
+				if(!(byte >> bit & 1)) continue;
+				if(pos < n) spread[k][byte] |= 1UL << position[pos];
+				syn ^= pos ^ 32;
+			}
+			syndrome[k][byte] = syn;
+		}
+	}
+
+	for(unsigned int d = 0; d < n; d++) {
+		unsigned int pos = position[d];
+		gather[pos >> 3][1 << (pos & 7)] = 1UL << d;
+	}
+	for(unsigned int k = 0; k < 4; k++) {
+		for(unsigned int byte = 0; byte < 256; byte++) {
+			/* Made of the single bits above */
+			unsigned long bits = 0;
+			for(unsigned int bit = 0; bit < 8; bit++) {
+				if(byte >> bit & 1) bits |= gather[k][1 << bit];
+			}
+			gather[k][byte] = bits;
+		}
+	}
+
+	for(unsigned int c = 0; c < 64; c++) {
+		unsigned long word = 0;
+		unsigned int ones = c >> 5;
+
+		for(unsigned int j = 0; j < 5; j++) {
+			if(c >> j & 1) {
+				word |= 1UL << (1 << j);
+				ones ^= 1;
+			}
+		}
+		checks[c] = word | ones;
+	}
+}
+
+/* The syndrome and parity of the low bytes bytes of a word */
+static inline unsigned int word_syndrome(unsigned long word, unsigned int bytes) {
+	unsigned int c = syndrome[0][word & 0xff];
+
+	if(bytes > 1) c ^= syndrome[1][word >> 8 & 0xff];
+	if(bytes > 2) c ^= syndrome[2][word >> 16 & 0xff] ^ syndrome[3][word >> 24 & 0xff];
+	return c;
+}
+
+/* Turns count symbols of data into codewords in place */
+static inline void encode(unsigned long *symbols, unsigned int count, unsigned int bytes) {
+	for(unsigned int i = 0; i < count; i++) {
+		unsigned long data = symbols[i];
+		unsigned long word = spread[0][data & 0xff];
+
+		if(bytes > 1) word |= spread[1][data >> 8 & 0xff];
+		if(bytes > 2) word |= spread[2][data >> 16 & 0xff] | spread[3][data >> 24 & 0xff];
+		symbols[i] = word | checks[word_syndrome(word, bytes)];
+	}
+}
+
+/* Decodes count codewords into their data. syndromes gets the syndrome of
+ * every word and in bit 5 whether its parity is odd, so 0 is a good word,
+ * bit 5 set one with the bit at the syndrome flipped, which is corrected,
+ * and anything else a word with two bits flipped. That one is irreparable,
+ * but the bit at the syndrome is flipped all the same, like it always was. */
+static inline void decode(const unsigned long *in, unsigned long *out, unsigned char *syndromes, unsigned long count, unsigned int bytes) {
+	for(unsigned long i = 0; i < count; i++) {
+		unsigned int c = word_syndrome(in[i], bytes);
+		unsigned long word = in[i] ^ (unsigned long)(c != 0) << (c & 31);
+		unsigned long data = gather[0][word & 0xff];
+
+		if(bytes > 1) data |= gather[1][word >> 8 & 0xff];
+		if(bytes > 2) data |= gather[2][word >> 16 & 0xff] | gather[3][word >> 24 & 0xff];
+		out[i] = data;
+		syndromes[i] = c;
+	}
+}
+
+/* Orders 2 and 3 fit in a byte, 4 in two and 5 in four */
+static void encode1(unsigned long *symbols, unsigned int count) { encode(symbols, count, 1); }
+static void encode2(unsigned long *symbols, unsigned int count) { encode(symbols, count, 2); }
+static void encode4(unsigned long *symbols, unsigned int count) { encode(symbols, count, 4); }
+static void decode1(const unsigned long *in, unsigned long *out, unsigned char *syndromes, unsigned long count) { decode(in, out, syndromes, count, 1); }
+static void decode2(const unsigned long *in, unsigned long *out, unsigned char *syndromes, unsigned long count) { decode(in, out, syndromes, count, 2); }
+static void decode4(const unsigned long *in, unsigned long *out, unsigned char *syndromes, unsigned long count) { decode(in, out, syndromes, count, 4); }
+
+static const struct HammingKernel kernels[] = {
+	{encode1, decode1}, /* 2 */
+	{encode1, decode1}, /* 3 */
+	{encode2, decode2}, /* 4 */
+	{encode4, decode4}  /* 5 */
+};
+
+/* The kernels for fec_order 2 to 5 */
+const struct HammingKernel *hamming_kernel(int fec_order) {
+	if(fec_order < 2 || fec_order > 5) {
+		fprintf(stderr, "Unsupported fec_order %d\n", fec_order);
+		exit(1);
+	}
+	pthread_once(&tables_once, make_tables);
+
+	return &kernels[fec_order - 2];
+}
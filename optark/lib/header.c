@@ -0,0 +1,105 @@
+// Copyright (c) GPL 2024 Arkanic <https://github.com/Arkanic>
+
+/* The header every page carries in band, so the decoder doesn't depend on the
+ * magic digits or the file names to put the pages together. It is packed into
+ * the first 46 of HEADER_BYTES big endian bytes, the rest are 0:
+ *
+ *  0  "OPT" and the version, 1
+ *  4  xcrosses, ycrosses, cpitch, chalf, fec_order, border, text_height, 16 bits each
+ * 18  page number, from 1, 32 bits
+ * 22  number of pages, 0 if not known yet, 32 bits
+ * 26  length of the whole payload, all ones if not known yet, 64 bits
+ * 34  payload bytes on this page, 32 bits
+ * 38  CRC-32 of them
+ * 42  CRC-32 of the bytes 0 to 41
+ *
+ * The bytes are cut into 12 bit words which are Golay coded independently of
+ * the fec_order of the page, so the header can be read with the wrong one.
+ * Bit k (from the MSB) of word w goes to channel bit k * HEADER_WORDS + w, so
+ * a scratch hits a bit of many words rather than many bits of one word. There
+ * is a copy at the start and one at the end of the channel, which puts them
+ * at the top and the bottom of the page. */
+
+#include <string.h>
+#include <zlib.h>
+
+#include "lib.h"
+
+static void put(unsigned char *ptr, unsigned long long value, unsigned int bytes) {
+	while(bytes--) {
+		ptr[bytes] = value;
+		value >>= 8;
+	}
+}
+
+static unsigned long long get(const unsigned char *ptr, unsigned int bytes) {
+	unsigned long long value = 0;
+
+	while(bytes--) value = value << 8 | *ptr++;
+	return value;
+}
+
+/* Renders header into HEADER_BITS channel bits, 1 is black */
+void header_encode(const struct PageHeader *header, unsigned char *bits) {
+	unsigned char bytes[HEADER_BYTES] = {'O', 'P', 'T', 1};
+	const struct PageFormat *format = &header->format;
+
+	put(bytes + 4, format->xcrosses, 2);
+	put(bytes + 6, format->ycrosses, 2);
+	put(bytes + 8, format->cpitch, 2);
+	put(bytes + 10, format->chalf, 2);
+	put(bytes + 12, format->fec_order, 2);
+	put(bytes + 14, format->border, 2);
+	put(bytes + 16, format->text_height, 2);
+	put(bytes + 18, header->page, 4);
+	put(bytes + 22, header->pages, 4);
+	put(bytes + 26, header->length, 8);
+	put(bytes + 34, header->bytes, 4);
+	put(bytes + 38, header->crc, 4);
+	put(bytes + 42, crc32(0, bytes, 42), 4);
+
+	for(unsigned int w = 0; w < HEADER_WORDS; w++) {
+		/* Two words in every three bytes */
+		unsigned long word = get(bytes + w / 2 * 3, 3) >> (w & 1 ? 0 : 12) & 0xfff;
+		unsigned long code = golay(word);
+
+		for(unsigned int k = 0; k < 24; k++) bits[k * HEADER_WORDS + w] = (code >> (23 - k)) & 1;
+	}
+}
+
+/* Reads a header rendered by header_encode. Returns 0 if it's damaged beyond
+ * repair. */
+int header_decode(struct PageHeader *header, const unsigned char *bits) {
+	unsigned char bytes[HEADER_BYTES] = {0};
+
+	for(unsigned int w = 0; w < HEADER_WORDS; w++) {
+		unsigned long code = 0;
+
+		for(unsigned int k = 0; k < 24; k++) code = code << 1 | (bits[k * HEADER_WORDS + w] & 1);
+
+		unsigned long error = golay_syndromes[(golay(code >> 12) ^ code) & 0xfff];
+		if(error == GOLAY_IRREPARABLE) return 0;
+		code = (code ^ error) >> 12;
+
+		unsigned char *ptr = bytes + w / 2 * 3;
+		put(ptr, get(ptr, 3) | code << (w & 1 ? 0 : 12), 3);
+	}
+
+	if(memcmp(bytes, "OPT\1", 4) || get(bytes + 42, 4) != crc32(0, bytes, 42)) return 0;
+
+	struct PageFormat *format = &header->format;
+	format->xcrosses = get(bytes + 4, 2);
+	format->ycrosses = get(bytes + 6, 2);
+	format->cpitch = get(bytes + 8, 2);
+	format->chalf = get(bytes + 10, 2);
+	format->fec_order = get(bytes + 12, 2);
+	format->border = get(bytes + 14, 2);
+	format->text_height = get(bytes + 16, 2);
+	header->page = get(bytes + 18, 4);
+	header->pages = get(bytes + 22, 4);
+	header->length = get(bytes + 26, 8);
+	header->bytes = get(bytes + 34, 4);
+	header->crc = get(bytes + 38, 4);
+
+	return 1;
+}
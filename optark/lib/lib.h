@@ -1,14 +1,261 @@
 /* (c) GPL 2007 Karel 'Clock' Kulhavy, Twibright Labs */
 // Copyright (c) GPL 2024 Arkanic <https://github.com/Arkanic>
 
+#include <stdio.h>
+#include <pthread.h>
+
 #include "optark.h"
 
 #define MIN(x,y) ((x) < (y) ? (x) : (y))
 #define MAX(x,y) ((x) > (y) ? (x) : (y))
 
+/* Symbols the encoder collects before running the FEC over them */
+#define SYMBOL_BATCH 4096
+#define PLANE_WORDS (SYMBOL_BATCH / 64) /* Of a bit plane of a batch */
+
+/* Levels of the image pyramid the decoder finds the corners in */
+#define PYRAMID_LEVELS 2
+
 #define TEXT_WIDTH 13 /* Width of a single letter */
 #define TEXT_HEIGHT 24 /* Height of a single letter */
 
+/* The page header, see header.c. 46 bytes in 32 Golay words. */
+#define HEADER_WORDS 32
+#define HEADER_BITS (HEADER_WORDS * 24) /* Channel bits of one copy */
+#define HEADER_BYTES (HEADER_WORDS * 3 / 2) /* What the words carry */
+
+struct PageHeader {
+	struct PageFormat format;
+	unsigned int page; /* From 1 */
+	unsigned int pages; /* 0 if not known when the page was written */
+	unsigned long long length; /* Of the whole payload, or OPTAR_UNKNOWN_LENGTH */
+	unsigned long bytes; /* Payload bytes on this page */
+	unsigned long crc; /* CRC-32 of them */
+};
+
+/* Hamming codes of one fec_order, see hamming.c */
+struct HammingKernel {
+	/* Data -> codewords, in place */
+	void (*encode)(unsigned long *symbols, unsigned int count);
+	/* Codewords -> data, and per word its syndrome with the parity in bit 5 */
+	void (*decode)(const unsigned long *in, unsigned long *out, unsigned char *syndromes, unsigned long count);
+};
+
+/* A horizontal run of channel bits lying in one cell of crosses. Coordinates
+ * are like in seq2xy. */
+struct LayoutRun {
+	unsigned long long seq; /* Sequence number of the first bit */
+	unsigned int x, y; /* Of the first bit */
+	unsigned int length;
+	unsigned short cx, cy; /* Cell, whose upper left cross is cx, cy */
+};
+
+/* Where the channel bits go on the page, shared by all pages of the same
+ * geometry. Built by page_layout() and freed by page_layout_release() once
+ * no encoder or decoder uses it. */
+struct PageLayout {
+	int xcrosses, ycrosses, cpitch, chalf; /* The geometry it was built for */
+	unsigned int n_runs;
+	struct LayoutRun *runs; /* [n_runs + 1], in sequence order. The last one
+				   is a sentinel with seq = totalbits. */
+	unsigned int users; /* Encoders and decoders holding it */
+	struct PageLayout *next;
+};
+
+/* State of one optar_file() run, see optark.h */
+struct OptarEncoder {
+	struct PageConstants constants;
+
+	struct OutputFormat *output;
+	unsigned char *ary; /* [stride * height] Packed 1 bit per pixel like in PBM */
+	unsigned int stride; /* Bytes per row of ary */
+	unsigned char *row; /* [stride * 8] One row expanded for PGM output */
+	unsigned char expand[256][8]; /* Byte of ary -> its 8 PGM pixels */
+	unsigned char *page_template; /* [stride * height] Border, crosses and the
+					 start of the label, copied into ary for
+					 every page */
+	char *label_txt; /* [label_size] Label of the current page */
+	size_t label_size;
+	size_t label_skip; /* Characters of the label already in page_template */
+	unsigned int label_x; /* Where the rest of the label starts */
+	char *file_label; /* The filename written in the file_label */
+	char *output_filename; /* The output filename */
+	unsigned output_filename_buffer_size;
+	char *base; /* Output filename base */
+	unsigned file_number;
+	FILE *output_stream;
+	unsigned n_pages; /* Number of pages calculated from the file length */
+	int streaming; /* The length is unknown, n_pages is set at the end */
+	unsigned long long input_length; /* OPTAR_UNKNOWN_LENGTH until a stream ends */
+	unsigned long page_fill; /* Payload bytes in the current page */
+	unsigned long page_crc; /* CRC-32 of them, for the page header */
+
+	const struct PageLayout *layout;
+	unsigned long long bitbuf; /* Payload bits not yet cut into a symbol */
+	unsigned int bitbuf_bits; /* Number of them, at the LSB end of bitbuf */
+	unsigned long *symbols; /* [SYMBOL_BATCH] collected for encoding */
+	unsigned int n_symbols;
+	unsigned long hamming_symbol; /* Next symbol to write in the current page */
+	const struct HammingKernel *hamming; /* Unless it's Golay */
+	unsigned int golay_parity[12]; /* Data planes XORed into parity plane p */
+	unsigned long long *planes; /* [fec_largebits][PLANE_WORDS] Bit planes of
+				       the batch being written */
+
+	/* Background page writer, only for compressed output. The page in
+	 * written_ary is the writer's until it sets it back to NULL. */
+	int writer_running;
+	pthread_t writer;
+	pthread_mutex_t writer_lock;
+	pthread_cond_t writer_cond;
+	unsigned char *written_ary;
+	FILE *written_stream;
+	char *written_filename;
+	unsigned char *spare_ary; /* The other page buffer */
+	unsigned int written_page;
+	int writer_quit;
+
+	struct PdfWriter *pdf; /* For OUTPUT_PDF */
+	int own_pdf; /* Opened by this encoder rather than shared */
+};
+
+/* Pixel to start a row of the flood fill from */
+struct FillSeed {
+	unsigned int x, y;
+};
+
+/* Bilinear interpolation between the 4 crosses surrounding one cell, expanded
+ * into value = a + h * hpar + v * vpar + hv * hpar * vpar so that it's affine
+ * along a row. Index 0 is a, 1 is h, 2 is v, 3 is hv. */
+struct Cell {
+	double x[4]; /* Integers in centers of pixels */
+	double y[4];
+	float cutlevel[4];
+};
+
+/* A page decoded ahead of the ones before it */
+struct PendingPage {
+	unsigned char *payload; /* NULL if not there yet */
+	unsigned long bytes;
+};
+
+/* State of one unoptar_file() run, see optark.h */
+struct OptarDecoder {
+	struct PageFormat format; /* A copy, the page headers can correct it */
+	struct PageConstants constants;
+	FILE *output_stream; /* Where the payload goes, unless there's a sink */
+	OptarPayloadSink sink;
+	void *sink_opaque;
+	unsigned int sync_jobs; /* Threads finding the crosses from a model of
+				   the page, 0 to find them one from another */
+	int warm_start; /* Seed the crosses of a page from the page before */
+
+	/* Putting the pages in order by their headers */
+	struct PendingPage *pending; /* [n_pending], by page number - 1 */
+	unsigned int n_pending;
+	unsigned int next_page; /* The next one to write out, from 1 */
+	unsigned int pages; /* From the page headers, 0 until known */
+	unsigned long long length; /* Likewise, OPTAR_UNKNOWN_LENGTH until known */
+	unsigned long long written; /* Payload bytes written out */
+	int damaged; /* A page was unreadable, damaged or missing, or the
+			output came out short */
+	int finished; /* check_complete() ran */
+
+	unsigned width, height; /* In pixels, not it symbols! The whole image including
+				   border, white surrounding etc. */
+	unsigned char *ary; /* Allocated to width*height */
+	unsigned char *newary; /* Allocated to width*height */
+
+	unsigned long histogram[256];
+	unsigned char *pyramid[PYRAMID_LEVELS]; /* Minimum of 4x4, 16x16... blocks of
+						   ary as loaded, for find_corners */
+	unsigned int pyramid_width[PYRAMID_LEVELS], pyramid_height[PYRAMID_LEVELS];
+	unsigned char global_cutlevel;
+	unsigned char fill_global_cutlevel; /* This is always set to 50% between
+					       black and white to make sure the
+					       border is not accidentally broken
+					       through as happened when
+					       global_cutlevel was used for
+					       filling. */
+	unsigned char average; /* Average pixel value */
+	unsigned long corners[4][2]; /* UL, UR, LL, LR / x, y. Integers in pixel upper
+				    left corners. */
+	unsigned long leftedge, rightedge, topedge, bottomedge; /* Coordinates,
+		minima/maxima of the corner coordinates. */
+	double (*crosses)[2]; /* [xcrosses * ycrosses] x, y of every cross, see
+				 CROSS(). Integers in pixel upper left corners. */
+	float *cutlevels; /* [xcrosses * ycrosses] Each cross has it's own cutlevel
+			     based on how it came out printed. */
+	struct Cell *cells; /* [(ycrosses - 1) * (xcrosses - 1)], row by row */
+	const struct PageLayout *layout;
+	unsigned char *channel_bits; /* [totalbits], indexed by channel
+					sequence number. 1 black, 0 white. */
+	int chalf; /* In the input image, measured in input image pixels!
+		      Important difference - in the decoding, the crosses are
+		      assumed twice as small!
+
+		      Calculated by find_corners. */
+	int search_radius; /* How far resync_cross looks around a cross, in
+			      input pixels each way. chalf unless the crosses
+			      are seeded from the last page. */
+	float *search_area; /* Allocated as soon as chalf is known. Width 4*chalf+1,
+			       height 4*chalf+1, of which a smaller
+			       search_radius uses less. The additional "+1" is for a row
+			       (topmost) and column (leftmost) of zeroes which are
+			       a result of integration.
+
+			       Before integration, position x,y (1...4*chalf) says
+			       pixel value, where the middle of the cross is
+			       just at the boundary between pixels [2*chalf] and
+			       [2*chalf+1].
+			       After integration, each pixel says integral including
+			       that pixel. */
+
+	unsigned long bad_01, bad_10; /* Flipped from 0 to 1 (black dirt),
+					 flipped from 1 to 0 (white dirt) */
+	unsigned long bad_total;
+	unsigned long irreparable;
+	unsigned long golay_stats[5]; /* 0, 1, 2, 3, 4 damaged bits */
+
+	double pixelhx, pixelhy, pixelvx, pixelvy; /* Horizontal (right) and vertical
+	(down) pixel vectors.They are initialized as soon as the corners are determined
+	and their length is equal to 1.  Used to compensate out rotation. System:
+	+x right, +y down */
+	double hpixel, vpixel; /* Pixel size calculated from the horizontal
+				  and vertical corner distance */
+	double (*warm_crosses)[2]; /* [xcrosses * ycrosses] The crosses of the last
+				      page, NULL before the first one */
+	unsigned long warm_corners[4][2]; /* And its corners */
+	struct FillSeed *fill_stack; /* [fill_size] Grows with the fill */
+	unsigned long fill_size;
+	FILE *input_stream;
+
+	unsigned char *payload; /* [(constants.netbits + 7) / 8] Payload of the
+				   current page, MSB first */
+	struct PageHeader header; /* Of the current page, page 0 if unreadable */
+	const struct HammingKernel *hamming; /* Unless it's Golay */
+	unsigned long *words; /* [constants.fec_syms] Received codewords */
+	unsigned long *data; /* [constants.fec_syms] Decoded symbols */
+	unsigned char *syndromes; /* [constants.fec_syms] Of the Hamming codewords */
+};
+
+/* One PDF file being written, see pdf.c */
+struct PdfWriter {
+	FILE *stream;
+	char *filename;
+	int level; /* zlib compression level */
+	double paper_width, paper_height; /* In points */
+	double image_width, image_height;
+
+	unsigned long long offset; /* Bytes written so far */
+	unsigned long long *objects; /* [objects_size] Offsets of the objects by number */
+	unsigned int objects_size;
+	unsigned int pages; /* Pages written so far */
+	unsigned int page_objects; /* 3, or 4 with the labels written at the end */
+	unsigned int label_y, label_height; /* Rows of the label */
+	pthread_mutex_t lock;
+	pthread_cond_t cond; /* Signalled after every page */
+};
+
 /* Functions from common.c */
 extern void compute_constants(struct PageConstants *out, struct PageFormat *format);
 extern void print_pageformat(struct PageFormat *format);
@@ -17,6 +264,22 @@ extern void prefill_pageformat(struct PageFormat *out);
 extern unsigned long parity(unsigned long in);
 extern int is_cross(struct PageConstants *constants, unsigned int x, unsigned int y);
 extern void seq2xy(struct PageConstants *constants, int *x, int *y, unsigned seq);
+extern const struct PageLayout *page_layout(struct PageConstants *constants);
+extern void page_layout_release(const struct PageLayout *layout);
+extern const struct LayoutRun *layout_find(const struct PageLayout *layout, unsigned long long seq);
+
+/* Functions from hamming.c */
+extern const struct HammingKernel *hamming_kernel(int fec_order);
+
+/* Functions from header.c */
+extern void header_encode(const struct PageHeader *header, unsigned char *bits);
+extern int header_decode(struct PageHeader *header, const unsigned char *bits);
+
+/* Functions from pdf.c */
+extern struct PdfWriter *pdf_open(struct OutputFormat *output, struct PageConstants *constants, char *basename, int late_labels);
+extern void pdf_page(struct PdfWriter *pdf, unsigned int page, unsigned char *ary, unsigned int stride, unsigned long width, unsigned long height);
+extern void pdf_label(struct PdfWriter *pdf, unsigned int page, unsigned char *rows, unsigned int stride, unsigned long width);
+extern void pdf_close(struct PdfWriter *pdf);
 
 /* Counts number of '1' bits */
 unsigned ones(unsigned long in);
@@ -24,3 +287,7 @@ unsigned ones(unsigned long in);
 /* Golay codes */
 unsigned long golay(unsigned long in);
 extern unsigned long golay_codes[4096];
+/* Syndrome (parity bits of golay(in >> 12) ^ in) -> error pattern with max. 3
+ * bits, or GOLAY_IRREPARABLE */
+extern unsigned long golay_syndromes[4096];
+#define GOLAY_IRREPARABLE 0xffffffffUL
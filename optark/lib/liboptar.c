@@ -5,6 +5,9 @@
 #include <stdlib.h>
 #include <string.h>
 #include <assert.h>
+#include <pthread.h>
+#include <png.h>
+#include <zlib.h>
 
 #define width font_width
 #define height font_height
@@ -13,293 +16,916 @@
 #undef height
 
 #include "lib.h"
-#include "parity.h"
-
-struct PageConstants optarconstants;
-
-static unsigned char *ary; //[WIDTH * HEIGHT];
-static unsigned char *file_label = (unsigned char *)""; /* The filename written in the file_label */
-static char *output_filename; /* The output filename */
-static unsigned output_filename_buffer_size;
-static unsigned char *base = (unsigned char *)"optar_out"; /* Output filename base */
-static unsigned file_number;
-FILE *output_stream;
-FILE *input_stream;
-unsigned n_pages; /* Number of pages calculated from the file length */
-
-void dump_ary(void) {
-	fprintf(output_stream,
-		"P5\n%lu %lu\n255\n",
-		optarconstants.width, optarconstants.height
-	);
 
-	fwrite(ary, optarconstants.width * optarconstants.height, 1, output_stream);
-}
-
-/* Only the LSB is significant. Writes hamming-encoded bits. The sequence number
- * must not be out of range! */
-void write_channelbit(unsigned char bit, unsigned long seq) {
-	int x, y; /* Positions of the pixel */
-
-	bit &= 1;
-	bit =- bit;
-	bit =~ bit; /* White=bit 0, black=bit 1 */
-	seq2xy(&optarconstants, &x, &y, seq); /* Returns without borders! */
-	x += optarconstants.format->border;
-	y += optarconstants.format->border;
-	ary[x + y * optarconstants.width] = bit;
-	seq++;
-}
-
-/* Groups into two groups of bits, 0...bit-1 and bit..., and then makes
- * a gap with zero between them by shifting the higer bits up. */
-unsigned long split(unsigned long in, unsigned bit) {
-	unsigned long high = in;
-	in &= (1UL << bit) - 1;
-	high ^= in;
-	return (high << 1) | in;
-}
-
-/* Thie bits are always stored in the LSB side of the register. Only the
- * lowest FEC_SMALLBITS are taken into account on input. */
-unsigned long hamming(unsigned long in) {
-	in &= (1UL << optarconstants.fec_smallbits) - 1;
-
-	in <<= 3; /* Split 0,1,2 */
-	if(optarconstants.format->fec_order >= 3) {
-		in = split(in, 4);
-		if(optarconstants.format->fec_order >= 4) {
-			in = split(in, 8);
-			if(optarconstants.format->fec_order >= 5) {
-				in = split(in, 16);
-				in |= parity(in & 0xffff0000) << 16;
-			}
-			in |= parity(in & 0xff00ff00) << 8;
+/* File name extensions, indexed by enum OutputType */
+static const char *output_extensions[] = {"pgm", "pbm", "png", "pdf", NULL};
+
+/* ary is a packed bitmap like in PBM: stride bytes per row, the MSB is the
+ * leftmost pixel and 1 is black. */
+
+static void dump_png(struct OptarEncoder *encoder, unsigned char *ary, FILE *stream, char *filename) {
+	png_structp png_ptr = png_create_write_struct(PNG_LIBPNG_VER_STRING, NULL, NULL, NULL);
+	png_infop info_ptr = png_ptr ? png_create_info_struct(png_ptr) : NULL;
+	if(!info_ptr) {
+		fprintf(stderr, "optar: cannot allocate PNG writer for %s\n", filename);
+		exit(1);
+	}
+	if(setjmp(png_jmpbuf(png_ptr))) {
+		fprintf(stderr, "optar: cannot write %s\n", filename);
+		exit(1);
+	}
+
+	png_init_io(png_ptr, stream);
+	png_set_compression_level(png_ptr, encoder->output->zlib_level);
+	png_set_IHDR(png_ptr, info_ptr, encoder->constants.width, encoder->constants.height,
+		1, PNG_COLOR_TYPE_GRAY, PNG_INTERLACE_NONE,
+		PNG_COMPRESSION_TYPE_DEFAULT, PNG_FILTER_TYPE_DEFAULT);
+	png_write_info(png_ptr, info_ptr);
+	png_set_invert_mono(png_ptr); /* In PNG, 0 is black */
+
+	for(unsigned int y = 0; y < encoder->constants.height; y++) {
+		png_write_row(png_ptr, ary + y * encoder->stride);
+	}
+
+	png_write_end(png_ptr, NULL);
+	png_destroy_write_struct(&png_ptr, &info_ptr);
+}
+
+static const char pgm_header[] = "P5\n%lu %lu\n255\n";
+static const char pbm_header[] = "P4\n%lu %lu\n";
+
+/* Writes count rows of ary from row first on into a PGM or PBM file */
+static void write_rows(struct OptarEncoder *encoder, unsigned char *ary, unsigned int first, unsigned int count, FILE *stream) {
+	if(encoder->output->type == OUTPUT_PBM) {
+		fwrite(ary + first * encoder->stride, encoder->stride * count, 1, stream);
+		return;
+	}
+
+	/* Expands into 0 for black and 255 for white, a byte at a time */
+	for(unsigned int y = first; y < first + count; y++) {
+		unsigned char *src = ary + y * encoder->stride;
+
+		for(unsigned int x = 0; x < encoder->stride; x++) {
+			memcpy(encoder->row + (x << 3), encoder->expand[src[x]], 8);
 		}
-		in |= parity(in & 0xf0f0f0f0) << 4;
+		fwrite(encoder->row, encoder->constants.width, 1, stream);
+	}
+}
+
+/* Writes page number page (from 1) out of ary */
+static void dump_ary(struct OptarEncoder *encoder, unsigned char *ary, unsigned int page, FILE *stream, char *filename) {
+	if(encoder->output->type == OUTPUT_BITMAP) {
+		encoder->output->sink(encoder->output->opaque, page, ary, encoder->constants.width, encoder->constants.height, encoder->stride);
+		return;
+	}
+
+	if(encoder->output->type == OUTPUT_PDF) {
+		pdf_page(encoder->pdf, page - 1, ary, encoder->stride, encoder->constants.width, encoder->constants.height);
+		return;
+	}
+
+	if(encoder->output->type == OUTPUT_PNG) {
+		dump_png(encoder, ary, stream, filename);
+		return;
+	}
+
+	fprintf(stream,
+		encoder->output->type == OUTPUT_PBM ? pbm_header : pgm_header,
+		encoder->constants.width, encoder->constants.height
+	);
+	write_rows(encoder, ary, 0, encoder->constants.height, stream);
+}
+
+/* Writes the pages handed over by close_page, so that compressing one page
+ * overlaps rendering the next one. */
+static void *page_writer(void *arg) {
+	struct OptarEncoder *encoder = arg;
+
+	pthread_mutex_lock(&encoder->writer_lock);
+	while(1) {
+		while(!encoder->written_ary && !encoder->writer_quit) pthread_cond_wait(&encoder->writer_cond, &encoder->writer_lock);
+		if(!encoder->written_ary) break;
+		pthread_mutex_unlock(&encoder->writer_lock);
+
+		dump_ary(encoder, encoder->written_ary, encoder->written_page, encoder->written_stream, encoder->written_filename);
+		if(encoder->written_stream) fclose(encoder->written_stream);
+
+		pthread_mutex_lock(&encoder->writer_lock);
+		encoder->written_ary = NULL;
+		pthread_cond_broadcast(&encoder->writer_cond);
 	}
-	in |= parity(in & 0xcccccccc) << 2;
-	in |= parity(in & 0xaaaaaaaa) << 1;
-	in |= parity(in);
+	pthread_mutex_unlock(&encoder->writer_lock);
 
-	return in;
+	return NULL;
+}
+
+/* Waits until the page writer has written everything handed to it */
+static void wait_writer(struct OptarEncoder *encoder) {
+	pthread_mutex_lock(&encoder->writer_lock);
+	while(encoder->written_ary) pthread_cond_wait(&encoder->writer_cond, &encoder->writer_lock);
+	pthread_mutex_unlock(&encoder->writer_lock);
+}
+
+/* Paints len pixels of row y from x on */
+static void fill(struct OptarEncoder *encoder, unsigned int x, unsigned int y, unsigned int len, int black) {
+	unsigned char *ptr = encoder->ary + y * encoder->stride + (x >> 3);
+	unsigned char value = black ? 0xff : 0;
+	unsigned char mask;
+
+	if(x & 7) {
+		unsigned int n = MIN(8 - (x & 7), len);
+		mask = (0xff >> (x & 7)) & ~(0xff >> ((x & 7) + n));
+		*ptr = (*ptr & ~mask) | (value & mask);
+		ptr++;
+		len -= n;
+	}
+	memset(ptr, value, len >> 3);
+	ptr += len >> 3;
+	if(len & 7) {
+		mask = ~(0xff >> (len & 7));
+		*ptr = (*ptr & ~mask) | (value & mask);
+	}
 }
 
-void border(void) {
-	char *ptr = (char *)(void *)ary;
+static void border(struct OptarEncoder *encoder) {
+	struct PageConstants *constants = &encoder->constants;
+	unsigned int y = 0;
 
-	memset(ptr, 0, optarconstants.format->border * optarconstants.width);
-	ptr += optarconstants.format->border * optarconstants.width;
-	for(unsigned int c = optarconstants.data_height; c; c--) {
-		memset(ptr, 0, optarconstants.format->border);
-		ptr += optarconstants.width;
-		memset(ptr - optarconstants.format->border, 0, optarconstants.format->border);
+	for(; y < constants->format->border; y++) fill(encoder, 0, y, constants->width, 1);
+	for(unsigned int c = constants->data_height; c; c--, y++) {
+		fill(encoder, 0, y, constants->format->border, 1);
+		fill(encoder, constants->width - constants->format->border, y, constants->format->border, 1);
 	}
-	memset(ptr, 0, optarconstants.format->text_height * optarconstants.width);
-	ptr += optarconstants.format->text_height * optarconstants.width;
-	/* BORDER bytes into the bottom border */
-	memset(ptr, 0, optarconstants.format->border * optarconstants.width);
+	/* The label and the bottom border */
+	for(; y < constants->height; y++) fill(encoder, 0, y, constants->width, 1);
 }
 
-void cross(int x, int y) {
-	unsigned char *ptr = ary + y * optarconstants.width + x;
+static void cross(struct OptarEncoder *encoder, int x, int y) {
+	unsigned int chalf = encoder->constants.format->chalf;
 
-	for (unsigned int c = optarconstants.format->chalf; c; c--, ptr += optarconstants.width){
-		memset(ptr, 0, optarconstants.format->chalf);
-		memset(ptr + optarconstants.format->chalf, 0xff, optarconstants.format->chalf);
-		memset(ptr + optarconstants.format->chalf * optarconstants.width, 0xff, optarconstants.format->chalf);
-		memset(ptr + optarconstants.format->chalf * (optarconstants.width + 1), 0, optarconstants.format->chalf);
+	for (unsigned int c = 0; c < chalf; c++) {
+		fill(encoder, x, y + c, chalf, 1);
+		fill(encoder, x + chalf, y + c, chalf, 0);
+		fill(encoder, x, y + chalf + c, chalf, 0);
+		fill(encoder, x + chalf, y + chalf + c, chalf, 1);
 	}
 }
 
-void crosses(void) {
-	for (unsigned int y = optarconstants.format->border; y <= optarconstants.height - optarconstants.format->text_height - optarconstants.format->border - 2 * optarconstants.format->chalf; y += optarconstants.format->cpitch) {
-		for (unsigned int x = optarconstants.format->border; x <= optarconstants.width - optarconstants.format->border - 2 * optarconstants.format->chalf; x += optarconstants.format->cpitch) {
-			cross(x, y);
+static void crosses(struct OptarEncoder *encoder) {
+	struct PageConstants *constants = &encoder->constants;
+
+	for (unsigned int y = constants->format->border; y <= constants->height - constants->format->text_height - constants->format->border - 2 * constants->format->chalf; y += constants->format->cpitch) {
+		for (unsigned int x = constants->format->border; x <= constants->width - constants->format->border - 2 * constants->format->chalf; x += constants->format->cpitch) {
+			cross(encoder, x, y);
 		}
 	}
 }
 
 /* x is in the range 0 to DATA_WIDTH-1 */
-void text_block(int destx, int srcx, int width) {
-	if(destx + width > optarconstants.data_width) return; /* Letter doesn't fit */
+static void text_block(struct OptarEncoder *encoder, int destx, int srcx, int width) {
+	struct PageConstants *constants = &encoder->constants;
+	if(destx + width > constants->data_width) return; /* Letter doesn't fit */
 
 	unsigned char *srcptr = (unsigned char *)(void *)header_data + srcx;
-	unsigned char *destptr = ary + optarconstants.width * (optarconstants.format->border + optarconstants.data_height) + optarconstants.format->border + destx;
+	unsigned char *destptr = encoder->ary + encoder->stride * (constants->format->border + constants->data_height);
+	destx += constants->format->border;
 
-	for(int y = 0; y < optarconstants.format->text_height; y++, srcptr += font_width, destptr += optarconstants.width) {
+	for(int y = 0; y < constants->format->text_height; y++, srcptr += font_width, destptr += encoder->stride) {
 		for(int x = 0; x < width; x++) {
-			destptr[x] = header_data_cmap[srcptr[x]][0] & 0x80 ? 0xff : 0;
+			unsigned char bit = 0x80 >> ((destx + x) & 7);
+
+			if(header_data_cmap[srcptr[x]][0] & 0x80) destptr[(destx + x) >> 3] &= ~bit;
+			else destptr[(destx + x) >> 3] |= bit;
 		}
 	}
 }
 
-void label(void) {
-	size_t txtsize = sizeof(char) * (optarconstants.data_width / TEXT_WIDTH);
-	char *txt = (char *)malloc(txtsize);
-	if(!txt) {
-		fprintf(stderr, "Cannot allocate txt");
-		exit(1);
+/* Renders the first len characters of txt from x on, returns where the next
+ * character would go */
+static unsigned int text(struct OptarEncoder *encoder, unsigned int x, const char *txt, size_t len) {
+	for(const unsigned char *ptr = (const unsigned char *)txt; ptr < (const unsigned char *)txt + len; ptr++) {
+		if(*ptr >= ' ' && *ptr <= 127) {
+			text_block(encoder, x, TEXT_WIDTH * (*ptr - ' '), TEXT_WIDTH);
+			x += TEXT_WIDTH;
+		}
 	}
 
-	snprintf(txt, txtsize, "  0-%u-%u-%u-%u-%u-%u-%u %u/%u %s",
-		optarconstants.format->xcrosses, optarconstants.format->ycrosses, optarconstants.format->cpitch, optarconstants.format->chalf,
-		optarconstants.format->fec_order, optarconstants.format->border, optarconstants.format->text_height,
-		file_number, n_pages,
-		(char *)(void *)file_label);
-	unsigned int txtlen = strlen((char *)(void *)txt);
+	return x;
+}
 
-	assert(font_height == optarconstants.format->text_height);
+/* Writes the label of the current page into label_txt */
+static void label_text(struct OptarEncoder *encoder) {
+	struct PageFormat *format = encoder->constants.format;
+
+	/* The number of pages of a stream is only known at its end */
+	if(encoder->streaming) {
+		snprintf(encoder->label_txt, encoder->label_size, "  0-%u-%u-%u-%u-%u-%u-%u %u/? %s",
+			format->xcrosses, format->ycrosses, format->cpitch, format->chalf,
+			format->fec_order, format->border, format->text_height,
+			encoder->file_number,
+			encoder->file_label);
+		return;
+	}
+
+	snprintf(encoder->label_txt, encoder->label_size, "  0-%u-%u-%u-%u-%u-%u-%u %u/%u %s",
+		format->xcrosses, format->ycrosses, format->cpitch, format->chalf,
+		format->fec_order, format->border, format->text_height,
+		encoder->file_number, encoder->n_pages,
+		encoder->file_label);
+}
+
+/* Renders the part of the label which is the same on all pages, up to the
+ * page number */
+static void label_prefix(struct OptarEncoder *encoder) {
+	struct PageFormat *format = encoder->constants.format;
+
+	assert(font_height == format->text_height);
 
 	int source_length = TEXT_WIDTH * (127 - ' ');
 	unsigned int x = font_width - source_length;
-	text_block(0, source_length, x);
+	text_block(encoder, 0, source_length, x);
 
-	for (unsigned char *ptr = (unsigned char *)(void *)txt; ptr < (unsigned char *)(void *)txt + txtlen; ptr++) {
-		if(*ptr >= ' ' && *ptr <= 127) {
-			text_block(x, TEXT_WIDTH * (*ptr - ' '), TEXT_WIDTH);
-			x += TEXT_WIDTH;
-		}
-	}
+	/* Up to and including the space after the format */
+	label_text(encoder);
+	char *number = strchr(encoder->label_txt + 2, ' ');
+	encoder->label_skip = number ? (size_t)(number + 1 - encoder->label_txt) : strlen(encoder->label_txt);
+	encoder->label_x = text(encoder, x, encoder->label_txt, encoder->label_skip);
 }
 
-void format_ary(void) {
-	memset(ary, 0xff, optarconstants.width * optarconstants.height); /* White */
-	border();
-	crosses();
-	label();
+/* Renders the rest of the label */
+static void label(struct OptarEncoder *encoder) {
+	label_text(encoder);
+	text(encoder, encoder->label_x, encoder->label_txt + encoder->label_skip, strlen(encoder->label_txt + encoder->label_skip));
 }
 
-/* Always formats ary. Dumps it if it's not the first one. */
-void new_file(void) {
-	if(file_number) {
-		dump_ary();
-		fclose(output_stream);
-	}
+/* Renders the layers which are the same on all pages into page_template */
+static void make_template(struct OptarEncoder *encoder) {
+	memset(encoder->ary, 0, encoder->stride * encoder->constants.height); /* White */
+	border(encoder);
+	crosses(encoder);
+	label_prefix(encoder);
+	memcpy(encoder->page_template, encoder->ary, encoder->stride * encoder->constants.height);
+}
 
-	if(file_number >= 9999) {
+static void format_ary(struct OptarEncoder *encoder) {
+	memcpy(encoder->ary, encoder->page_template, encoder->stride * encoder->constants.height);
+	label(encoder);
+}
+
+static void page_filename(struct OptarEncoder *encoder, unsigned file_number) {
+	snprintf(encoder->output_filename, encoder->output_filename_buffer_size, "%s_%04u.%s", encoder->base, file_number, output_extensions[encoder->output->type]);
+}
+
+/* Opens the output file of page file_number, formats ary for it and starts
+ * its payload. PDF pages all go into the one file, bitmaps into none. */
+static void open_page(struct OptarEncoder *encoder, unsigned file_number) {
+	encoder->file_number = file_number;
+	encoder->hamming_symbol = 0;
+	encoder->bitbuf_bits = 0;
+	encoder->page_fill = 0;
+	encoder->page_crc = crc32(0, NULL, 0);
+	format_ary(encoder);
+	if(encoder->output->type == OUTPUT_PDF || encoder->output->type == OUTPUT_BITMAP) return;
+
+	if(file_number > 9999) {
 		fprintf(stderr, "optar: too many pages - 10,000 or more\n");
 		exit(1);
 	}
 
-	snprintf(output_filename, output_filename_buffer_size, "%s_%04u.pgm", (char *)(void *)base, ++file_number);
-	output_stream = fopen(output_filename, "w");
-	if(!output_stream) {
-		fprintf(stderr, "optar: cannot open %s for writing.\n", output_filename);
+	page_filename(encoder, file_number);
+	encoder->output_stream = fopen(encoder->output_filename, "w");
+	if(!encoder->output_stream) {
+		fprintf(stderr, "optar: cannot open %s for writing.\n", encoder->output_filename);
 		exit(1);
 	}
-	format_ary();
 }
 
-void end_files(void) {
-    fclose(input_stream);
+/* Sets the black ones of count channel bits from sequence number seq on */
+static void write_channel(struct OptarEncoder *encoder, unsigned long long seq, const unsigned char *bits, unsigned int count) {
+	unsigned int border = encoder->constants.format->border;
+	const struct LayoutRun *run = layout_find(encoder->layout, seq);
+
+	for(unsigned int i = 0; i < count; run++) {
+		unsigned int skip = seq - run->seq;
+		unsigned int n = MIN(run->length - skip, count - i);
+		unsigned char *row = encoder->ary + (run->y + border) * encoder->stride;
+		unsigned int x = run->x + border + skip;
+
+		for(unsigned int end = i + n; i < end; i++, x++) {
+			row[x >> 3] |= (bits[i] & 1) << (7 - (x & 7));
+		}
+		seq += n;
+	}
+}
+
+/* Writes both copies of the page header, once the payload of the page is
+ * complete. A streamed input only knows its length on the last page. */
+static void write_header(struct OptarEncoder *encoder) {
+	struct PageConstants *constants = &encoder->constants;
+	struct PageHeader header = {
+		.format = *constants->format,
+		.page = encoder->file_number,
+		.pages = encoder->input_length == OPTAR_UNKNOWN_LENGTH ? 0 : encoder->n_pages,
+		.length = encoder->input_length,
+		.bytes = encoder->page_fill,
+		.crc = encoder->page_crc
+	};
+	unsigned char bits[HEADER_BITS];
+
+	header_encode(&header, bits);
+	write_channel(encoder, 0, bits, HEADER_BITS);
+	write_channel(encoder, constants->totalbits - constants->headerbits, bits, HEADER_BITS);
 }
 
-/* That's the net channel capacity */
-void write_payloadbit(unsigned char bit) {
-	static unsigned long accu = 1;
-	static unsigned long hamming_symbol;
+static void close_page(struct OptarEncoder *encoder) {
+	write_header(encoder);
+	if(!encoder->writer_running) {
+		dump_ary(encoder, encoder->ary, encoder->file_number, encoder->output_stream, encoder->output_filename);
+		if(encoder->output_stream) fclose(encoder->output_stream);
+		encoder->output_stream = NULL;
+		return;
+	}
 
-	accu <<= 1;
-	accu |= bit & 1;
-	if(accu & (1UL << optarconstants.fec_smallbits)) {
-		/* Full payload */
-		int shift;
+	/* Hand the page over and continue in the buffer the writer is done
+	 * with */
+	unsigned char *page = encoder->ary;
+	wait_writer(encoder);
+	pthread_mutex_lock(&encoder->writer_lock);
+	encoder->written_ary = page;
+	encoder->written_page = encoder->file_number;
+	encoder->written_stream = encoder->output_stream;
+	strcpy(encoder->written_filename, encoder->output_filename);
+	pthread_cond_broadcast(&encoder->writer_cond);
+	pthread_mutex_unlock(&encoder->writer_lock);
+
+	encoder->ary = encoder->spare_ary;
+	encoder->spare_ary = page;
+	encoder->output_stream = NULL;
+}
 
-		/* Expands from FEC_SMALLBITS bits to FEC_LARGEBITS */
-		if(optarconstants.format->fec_order == 1) {
-			accu = golay(accu);
-		} else {
-			accu = hamming(accu);
-		}
+/* Always formats ary. Dumps it if it's not the first one. */
+static void new_file(struct OptarEncoder *encoder) {
+	if(encoder->file_number) close_page(encoder);
+	open_page(encoder, encoder->file_number + 1);
+}
+
+/* ORs the n (max. 64) bits at the MSB end of bits into row from pixel x on */
+static inline void or_bits(unsigned char *row, unsigned int x, unsigned long long bits, unsigned int n) {
+	unsigned char *ptr = row + (x >> 3);
+	unsigned int first = x & 7;
+
+	if(n < 64) bits &= ~(~0ULL >> n);
+	*ptr++ |= bits >> (56 + first);
+	bits <<= 8 - first;
+	for(int left = (int)(n + first) - 8; left > 0; left -= 8) {
+		*ptr++ |= bits >> 56;
+		bits <<= 8;
+	}
+}
 
-		if(hamming_symbol >= optarconstants.fec_syms) {
-			/* We couldn't write into the page, we need to make
-			 * another one */
-			new_file();
-			hamming_symbol = 0;
+/* Writes count bits of a plane from sequence number seq on. The channel is
+ * walked run by run and every run takes up to 64 bits at once. The data area
+ * is still white from the template, so only the black bits are set. */
+static void write_plane(struct OptarEncoder *encoder, unsigned long long seq, const unsigned long long *plane, unsigned int count) {
+	unsigned int border = encoder->constants.format->border;
+	const struct LayoutRun *run = layout_find(encoder->layout, seq);
+
+	for(unsigned int i = 0; i < count; run++) {
+		unsigned int skip = seq - run->seq;
+		unsigned int n = MIN(run->length - skip, count - i);
+		unsigned char *row = encoder->ary + (run->y + border) * encoder->stride;
+		unsigned int x = run->x + border + skip;
+
+		for(unsigned int end = i + n; i < end;) {
+			unsigned int m = MIN(end - i, 64 - (i & 63));
+
+			or_bits(row, x, plane[i >> 6] << (i & 63), m);
+			i += m;
+			x += m;
 		}
+		seq += n;
+	}
+}
+
+/* Transposes count symbols of nbits bits into bit planes of PLANE_WORDS
+ * words: bit k (from the MSB) of symbol i becomes bit i of plane k, again
+ * counted from the MSB of the first word. */
+static void slice(const unsigned long *symbols, unsigned int count, unsigned int nbits, unsigned long long *planes) {
+	for(unsigned int w = 0; w * 64 < count; w++) {
+		const unsigned long *block = symbols + w * 64;
+		unsigned int n = MIN(count - w * 64, 64);
 
-		/* Write the symbol into the page */
-		for(shift = optarconstants.fec_largebits - 1; shift >= 0; shift--) {
-			write_channelbit(accu>>shift, hamming_symbol + (optarconstants.fec_largebits - 1 - shift) * optarconstants.fec_syms);
+		for(unsigned int k = 0; k < nbits; k++) {
+			unsigned int shift = nbits - 1 - k;
+			unsigned long long plane = 0;
+
+			for(unsigned int i = 0; i < n; i++) plane |= (unsigned long long)(block[i] >> shift & 1) << (63 - i);
+			planes[k * PLANE_WORDS + w] = plane;
 		}
+	}
+}
 
-		accu = 1;
-		hamming_symbol++;
+/* Golay codes bit sliced: the data bits are the first 12 planes and every
+ * parity plane is the XOR of the data planes in its golay_parity mask, so 64
+ * symbols are coded at once. */
+static void golay_planes(struct OptarEncoder *encoder, unsigned int count) {
+	unsigned long long *planes = encoder->planes;
+	unsigned int words = (count + 63) / 64;
+
+	slice(encoder->symbols, count, 12, planes);
+	for(unsigned int p = 0; p < 12; p++) {
+		unsigned long long *parity = planes + (12 + p) * PLANE_WORDS;
+		unsigned int mask = encoder->golay_parity[p];
+
+		for(unsigned int w = 0; w < words; w++) parity[w] = 0;
+		for(unsigned int k = 0; k < 12; k++) {
+			if(!(mask >> k & 1)) continue;
+			for(unsigned int w = 0; w < words; w++) parity[w] ^= planes[k * PLANE_WORDS + w];
+		}
 	}
 }
 
-void write_byte(unsigned char c) {
-	for(int bit = 7; bit >= 0; bit--) write_payloadbit(c >> bit);
+/* Expands the collected symbols from FEC_SMALLBITS bits to FEC_LARGEBITS and
+ * writes them into the current page, the first one being symbol number
+ * hamming_symbol. Bit k (counted from the MSB) of a symbol goes to sequence
+ * number headerbits + symbol + k * fec_syms, so the symbols fill one
+ * contiguous stretch of every bit plane. They always fit, as a page only
+ * takes page_bytes of payload. */
+static void flush_symbols(struct OptarEncoder *encoder) {
+	struct PageConstants *constants = &encoder->constants;
+	unsigned int n = encoder->n_symbols;
+
+	if(constants->format->fec_order == 1) {
+		golay_planes(encoder, n);
+	} else {
+		encoder->hamming->encode(encoder->symbols, n);
+		slice(encoder->symbols, n, constants->fec_largebits, encoder->planes);
+	}
+
+	assert(encoder->hamming_symbol + n <= constants->fec_syms);
+	for(unsigned int k = 0; k < constants->fec_largebits; k++) {
+		unsigned long long seq = constants->headerbits + encoder->hamming_symbol + k * constants->fec_syms;
+		write_plane(encoder, seq, encoder->planes + k * PLANE_WORDS, n);
+	}
+	encoder->hamming_symbol += n;
+	encoder->n_symbols = 0;
 }
 
-/* Prints the text at the bottom */
-/* Makes one output file. */
-void feed_data(void) {
-	int c;
-	while((c=fgetc(input_stream))!=EOF) {
-		write_byte(c);
+/* Appends the nbits (max. 32) low bits of bits to the payload, MSB first, and
+ * cuts off every full symbol. */
+static void feed_bits(struct OptarEncoder *encoder, unsigned long bits, unsigned int nbits) {
+	unsigned int smallbits = encoder->constants.fec_smallbits;
+
+	encoder->bitbuf = (encoder->bitbuf << nbits) | bits;
+	encoder->bitbuf_bits += nbits;
+	while(encoder->bitbuf_bits >= smallbits) {
+		encoder->bitbuf_bits -= smallbits;
+		encoder->symbols[encoder->n_symbols++] = (encoder->bitbuf >> encoder->bitbuf_bits) & ((1UL << smallbits) - 1);
+		if(encoder->n_symbols == SYMBOL_BATCH) flush_symbols(encoder);
 	}
+}
 
-	/* Flush the FEC with zeroes */
-	for(c = optarconstants.fec_smallbits - 1; c; c--) {
-		write_payloadbit(0);
+/* Appends len bytes to the payload of the current page, which must have room
+ * for them */
+static void feed_bytes(struct OptarEncoder *encoder, const unsigned char *ptr, size_t len) {
+	encoder->page_crc = crc32(encoder->page_crc, ptr, len);
+	encoder->page_fill += len;
+	for(; len >= 4; len -= 4, ptr += 4) {
+		feed_bits(encoder, (unsigned long)ptr[0] << 24 | ptr[1] << 16 | ptr[2] << 8 | ptr[3], 32);
 	}
+	for(; len; len--) feed_bits(encoder, *ptr++, 8);
+}
 
-	dump_ary();
-	fclose(output_stream);
+/* Completes the last symbol with zeroes and writes out everything pending */
+static void flush_fec(struct OptarEncoder *encoder) {
+	if(encoder->bitbuf_bits) {
+		feed_bits(encoder, 0, encoder->constants.fec_smallbits - encoder->bitbuf_bits);
+	}
+	flush_symbols(encoder);
 }
 
-void open_input_file(char *fname) {
-	input_stream = fopen(fname, "r");
+/* "-" is stdin */
+static FILE *open_input(char *fname) {
+	if(!strcmp(fname, "-")) return stdin;
+
+	FILE *input_stream = fopen(fname, "r");
 	if(!input_stream) {
 		fprintf(stderr, "optar: cannot open input file %s: ", fname);
 		perror("");
 		exit(1);
 	}
+	return input_stream;
+}
 
-	if(fseek(input_stream, 0, SEEK_END)) {
-		fprintf(stderr, "optar: cannot seek to the end of %s: ", fname);
-		perror("");
-		exit(1);
-	}
+/* Returns the input length and leaves the file at its beginning, or
+ * OPTAR_UNKNOWN_LENGTH if it can't seek, like a pipe. */
+static unsigned long long input_length(FILE *input_stream, char *fname) {
+	if(fseek(input_stream, 0, SEEK_END)) return OPTAR_UNKNOWN_LENGTH;
 
-	n_pages = (((unsigned long)ftell(input_stream) << 3) + optarconstants.netbits - 1) / optarconstants.netbits;
+	unsigned long long length = ftell(input_stream);
 	if(fseek(input_stream, 0, SEEK_SET)) {
 		fprintf(stderr, "optar: cannot seek to the beginning of %s: ", fname);
 		perror("");
 		exit(1);
 	}
+
+	return length;
 }
 
-// EXTERNAL FUNCTIONS START HERE
+/* Everything but the first page */
+static struct OptarEncoder *encoder_alloc(struct PageFormat *format, struct OutputFormat *output, char *output_basename, unsigned long long input_length) {
+	struct OptarEncoder *encoder = calloc(1, sizeof(*encoder));
+	if(!encoder) {
+		fprintf(stderr, "Cannot allocate encoder\n");
+		exit(1);
+	}
 
-int optar_file(struct PageFormat *format, char *input_filename, char *output_basename) {
-    compute_constants(&optarconstants, format);
+	compute_constants(&encoder->constants, format);
 
-    ary = (unsigned char *)malloc(sizeof(unsigned char) * optarconstants.width * optarconstants.height);
-	if(!ary) {
+	encoder->output = output;
+	encoder->stride = (encoder->constants.width + 7) >> 3;
+	encoder->ary = (unsigned char *)malloc(sizeof(unsigned char) * encoder->stride * encoder->constants.height);
+	encoder->row = malloc(encoder->stride << 3);
+	if(!encoder->ary || !encoder->row) {
 		fprintf(stderr, "Canont allocate full array\n");
 		exit(1);
 	}
 
-    open_input_file(input_filename);
+	encoder->input_length = input_length;
+	if(input_length == OPTAR_UNKNOWN_LENGTH) encoder->streaming = 1;
+	else encoder->n_pages = input_length ? (input_length + encoder->constants.page_bytes - 1) / encoder->constants.page_bytes : 1;
 
-    file_label = base = output_basename;
-    output_filename_buffer_size = strlen(base) + 1 + 4 + 1 + 3 + 1;
-    output_filename = malloc(sizeof(char) * output_filename_buffer_size);
-    if(!output_filename) {
-        fprintf(stderr, "Cannot allocate output_filename\n");
-        exit(1);
-    }
+	encoder->file_label = encoder->base = output_basename;
+	encoder->output_filename_buffer_size = strlen(encoder->base) + 1 + 4 + 1 + 3 + 1;
+	encoder->output_filename = malloc(sizeof(char) * encoder->output_filename_buffer_size);
+	if(!encoder->output_filename) {
+		fprintf(stderr, "Cannot allocate output_filename\n");
+		exit(1);
+	}
 
-    new_file();
-    feed_data();
-    end_files();
+	if(output->type == OUTPUT_PNG || output->type == OUTPUT_PDF) {
+		/* Compression gets its own thread and a second page buffer */
+		encoder->spare_ary = malloc(encoder->stride * encoder->constants.height);
+		encoder->written_filename = malloc(encoder->output_filename_buffer_size);
+		if(!encoder->spare_ary || !encoder->written_filename) {
+			fprintf(stderr, "Cannot allocate page writer\n");
+			exit(1);
+		}
+		pthread_mutex_init(&encoder->writer_lock, NULL);
+		pthread_cond_init(&encoder->writer_cond, NULL);
+		if(pthread_create(&encoder->writer, NULL, page_writer, encoder)) {
+			fprintf(stderr, "optar: cannot start page writer thread\n");
+			exit(1);
+		}
+		encoder->writer_running = 1;
+	}
+
+	for(unsigned int byte = 0; byte < 256; byte++) {
+		for(unsigned int bit = 0; bit < 8; bit++) encoder->expand[byte][bit] = ((byte >> (7 - bit)) & 1) - 1;
+	}
+
+	encoder->page_template = malloc(encoder->stride * encoder->constants.height);
+	encoder->label_size = encoder->constants.data_width / TEXT_WIDTH;
+	encoder->label_txt = malloc(encoder->label_size);
+	if(!encoder->page_template || !encoder->label_txt) {
+		fprintf(stderr, "Cannot allocate page template\n");
+		exit(1);
+	}
+	make_template(encoder);
+
+	encoder->layout = page_layout(&encoder->constants);
+	if(format->fec_order != 1) {
+		encoder->hamming = hamming_kernel(format->fec_order);
+	} else {
+		/* The code is linear, so parity bit p is the XOR of the data bits
+		 * whose own codeword has it set */
+		for(unsigned int p = 0; p < 12; p++) {
+			encoder->golay_parity[p] = 0;
+			for(unsigned int i = 0; i < 12; i++) {
+				if(golay(1UL << i) >> (11 - p) & 1) encoder->golay_parity[p] |= 1U << (11 - i);
+			}
+		}
+	}
+	encoder->symbols = malloc(sizeof(*encoder->symbols) * SYMBOL_BATCH);
+	encoder->planes = malloc(sizeof(*encoder->planes) * PLANE_WORDS * encoder->constants.fec_largebits);
+	if(!encoder->symbols || !encoder->planes) {
+		fprintf(stderr, "Cannot allocate symbol buffer\n");
+		exit(1);
+	}
+
+	return encoder;
+}
+
+/* Shared by the threads of optar_file_parallel */
+struct EncodeJob {
+	struct PageFormat *format;
+	struct OutputFormat *output;
+	struct PdfWriter *pdf; /* Shared by all the workers for OUTPUT_PDF */
+	char *input_filename;
+	char *output_basename;
+	unsigned long long input_length;
+	unsigned int pages;
+	unsigned int next; /* Next page to be taken by a worker, from 0 */
+	pthread_mutex_t lock;
+};
+
+/* Renders page number page (from 0) on its own. Its payload are the
+ * page_bytes input bytes from page * page_bytes on. */
+static void encode_page(struct OptarEncoder *encoder, FILE *input_stream, unsigned char *buffer, unsigned long long input_length, unsigned int page) {
+	unsigned long long start = (unsigned long long)page * encoder->constants.page_bytes;
+	size_t bytes = MIN(encoder->constants.page_bytes, input_length - start);
+
+	if(fseek(input_stream, start, SEEK_SET) || fread(buffer, 1, bytes, input_stream) != bytes) {
+		fprintf(stderr, "optar: cannot read page %u of the input: ", page + 1);
+		perror("");
+		exit(1);
+	}
+
+	open_page(encoder, page + 1);
+	feed_bytes(encoder, buffer, bytes);
+	flush_fec(encoder);
+	close_page(encoder);
+}
+
+static void *encode_worker(void *arg) {
+	struct EncodeJob *job = arg;
+	struct OptarEncoder *encoder = encoder_alloc(job->format, job->output, job->output_basename, job->input_length);
+	encoder->pdf = job->pdf;
+	unsigned char *buffer = malloc(encoder->constants.page_bytes);
+	FILE *input_stream = fopen(job->input_filename, "r");
+	if(!buffer) {
+		fprintf(stderr, "Cannot allocate input buffer\n");
+		exit(1);
+	}
+	if(!input_stream) {
+		fprintf(stderr, "optar: cannot open input file %s: ", job->input_filename);
+		perror("");
+		exit(1);
+	}
+
+	while(1) {
+		pthread_mutex_lock(&job->lock);
+		unsigned int page = job->next++;
+		pthread_mutex_unlock(&job->lock);
+		if(page >= job->pages) break;
+
+		encode_page(encoder, input_stream, buffer, job->input_length, page);
+	}
+
+	fclose(input_stream);
+	free(buffer);
+	optar_encoder_destroy(encoder);
+	return NULL;
+}
+
+/* Reads a page written by dump_png back into ary */
+static void load_png(struct OptarEncoder *encoder, FILE *stream, char *filename) {
+	png_structp png_ptr = png_create_read_struct(PNG_LIBPNG_VER_STRING, NULL, NULL, NULL);
+	png_infop info_ptr = png_ptr ? png_create_info_struct(png_ptr) : NULL;
+	if(!info_ptr) {
+		fprintf(stderr, "optar: cannot allocate PNG reader for %s\n", filename);
+		exit(1);
+	}
+	if(setjmp(png_jmpbuf(png_ptr))) {
+		fprintf(stderr, "optar: cannot read %s back\n", filename);
+		exit(1);
+	}
+
+	png_init_io(png_ptr, stream);
+	png_read_info(png_ptr, info_ptr);
+	if(png_get_image_width(png_ptr, info_ptr) != encoder->constants.width
+		|| png_get_image_height(png_ptr, info_ptr) != encoder->constants.height
+		|| png_get_bit_depth(png_ptr, info_ptr) != 1) {
+		fprintf(stderr, "optar: %s has changed since it was written\n", filename);
+		exit(1);
+	}
+	png_set_invert_mono(png_ptr);
+
+	for(unsigned int y = 0; y < encoder->constants.height; y++) {
+		png_read_row(png_ptr, encoder->ary + y * encoder->stride, NULL);
+	}
+
+	png_destroy_read_struct(&png_ptr, &info_ptr, NULL);
+}
+
+/* Once a stream has ended, replaces the "N/?" labels of the pages already
+ * written with "N/M". PGM and PBM only get their label rows rewritten in
+ * place, PNG is read back and compressed again and PDF gets label strips
+ * drawn over the old labels. Pages given to a sink keep theirs. */
+static void fix_labels(struct OptarEncoder *encoder) {
+	struct PageConstants *constants = &encoder->constants;
+	unsigned int pages = encoder->file_number;
+	unsigned int label_y = constants->format->border + constants->data_height;
+	size_t label_offset = label_y * encoder->stride;
+	size_t label_len = constants->format->text_height * encoder->stride;
+
+	encoder->streaming = 0;
+	encoder->n_pages = pages;
+	if(encoder->output->type == OUTPUT_BITMAP) return;
+
+	for(unsigned int page = 1; page <= pages; page++) {
+		encoder->file_number = page;
+		page_filename(encoder, page);
+
+		FILE *stream = NULL;
+		if(encoder->output->type != OUTPUT_PDF) {
+			stream = fopen(encoder->output_filename, "r+b");
+			if(!stream) {
+				fprintf(stderr, "optar: cannot reopen %s: ", encoder->output_filename);
+				perror("");
+				exit(1);
+			}
+		}
+
+		if(encoder->output->type == OUTPUT_PNG) load_png(encoder, stream, encoder->output_filename);
+		memcpy(encoder->ary + label_offset, encoder->page_template + label_offset, label_len);
+		label(encoder);
+
+		if(encoder->output->type == OUTPUT_PDF) {
+			pdf_label(encoder->pdf, page - 1, encoder->ary + label_offset, encoder->stride, constants->width);
+			continue;
+		}
+
+		if(encoder->output->type == OUTPUT_PNG) {
+			/* The new page can be shorter */
+			stream = freopen(encoder->output_filename, "wb", stream);
+			if(!stream) {
+				fprintf(stderr, "optar: cannot reopen %s: ", encoder->output_filename);
+				perror("");
+				exit(1);
+			}
+			dump_png(encoder, encoder->ary, stream, encoder->output_filename);
+		} else {
+			int pbm = encoder->output->type == OUTPUT_PBM;
+			long header = snprintf(NULL, 0, pbm ? pbm_header : pgm_header, constants->width, constants->height);
+
+			if(fseek(stream, header + (long)label_y * (pbm ? encoder->stride : constants->width), SEEK_SET)) {
+				fprintf(stderr, "optar: cannot seek in %s: ", encoder->output_filename);
+				perror("");
+				exit(1);
+			}
+			write_rows(encoder, encoder->ary, label_y, constants->format->text_height, stream);
+		}
+		if(fclose(stream)) {
+			fprintf(stderr, "optar: cannot write %s: ", encoder->output_filename);
+			perror("");
+			exit(1);
+		}
+	}
+}
+
+/* Encodes the rest of input_stream and closes it. length can be
+ * OPTAR_UNKNOWN_LENGTH. */
+static int encode_stream(struct PageFormat *format, struct OutputFormat *output, FILE *input_stream, unsigned long long length, char *output_basename) {
+	struct OptarEncoder *encoder = optar_encoder_create(format, output, output_basename, length);
+
+	unsigned char buffer[65536];
+	size_t got;
+	while((got = fread(buffer, 1, sizeof(buffer), input_stream))) {
+		optar_encoder_feed(encoder, buffer, got);
+	}
+	if(ferror(input_stream)) {
+		fprintf(stderr, "optar: cannot read the input: ");
+		perror("");
+		exit(1);
+	}
+	if(input_stream != stdin) fclose(input_stream);
 
-    free(output_filename);
-    free(ary);
+	int pages = optar_encoder_finish(encoder);
+	optar_encoder_destroy(encoder);
+
+	return pages;
+}
+
+// EXTERNAL FUNCTIONS START HERE
+
+struct OptarEncoder *optar_encoder_create(struct PageFormat *format, struct OutputFormat *output, char *output_basename, unsigned long long input_length) {
+	struct OptarEncoder *encoder = encoder_alloc(format, output, output_basename, input_length);
+	if(output->type == OUTPUT_PDF) {
+		encoder->pdf = pdf_open(output, &encoder->constants, output_basename, encoder->streaming);
+		encoder->own_pdf = 1;
+	}
+	new_file(encoder);
+
+	return encoder;
+}
+
+void optar_encoder_feed(struct OptarEncoder *encoder, const void *data, size_t len) {
+	const unsigned char *ptr = data;
+	unsigned long page_bytes = encoder->constants.page_bytes;
+
+	while(len) {
+		if(encoder->page_fill == page_bytes) new_file(encoder);
+
+		size_t n = MIN(len, page_bytes - encoder->page_fill);
+		feed_bytes(encoder, ptr, n);
+		if(encoder->page_fill == page_bytes) flush_fec(encoder);
+		ptr += n;
+		len -= n;
+	}
+}
 
-    return file_number;
-}
\ No newline at end of file
+int optar_encoder_finish(struct OptarEncoder *encoder) {
+	if(encoder->streaming) {
+		/* The last page's header gets the totals */
+		encoder->n_pages = encoder->file_number;
+		encoder->input_length = (unsigned long long)(encoder->file_number - 1) * encoder->constants.page_bytes + encoder->page_fill;
+	}
+	flush_fec(encoder);
+	close_page(encoder);
+	if(encoder->writer_running) wait_writer(encoder);
+	if(encoder->streaming) fix_labels(encoder);
+	if(encoder->own_pdf) {
+		pdf_close(encoder->pdf);
+		encoder->pdf = NULL;
+	}
+
+	return encoder->file_number;
+}
+
+void optar_encoder_destroy(struct OptarEncoder *encoder) {
+	if(encoder->writer_running) {
+		pthread_mutex_lock(&encoder->writer_lock);
+		encoder->writer_quit = 1;
+		pthread_cond_broadcast(&encoder->writer_cond);
+		pthread_mutex_unlock(&encoder->writer_lock);
+		pthread_join(encoder->writer, NULL);
+
+		pthread_cond_destroy(&encoder->writer_cond);
+		pthread_mutex_destroy(&encoder->writer_lock);
+		free(encoder->spare_ary);
+		free(encoder->written_filename);
+	}
+	if(encoder->own_pdf && encoder->pdf) pdf_close(encoder->pdf);
+	if(encoder->output_stream) fclose(encoder->output_stream);
+	free(encoder->output_filename);
+	free(encoder->ary);
+	free(encoder->row);
+	free(encoder->page_template);
+	free(encoder->label_txt);
+	free(encoder->symbols);
+	free(encoder->planes);
+	page_layout_release(encoder->layout);
+	free(encoder);
+}
+
+int optar_file(struct PageFormat *format, struct OutputFormat *output, char *input_filename, char *output_basename) {
+	FILE *input_stream = open_input(input_filename);
+	return encode_stream(format, output, input_stream, input_length(input_stream, input_filename), output_basename);
+}
+
+int optar_buffer(struct PageFormat *format, struct OutputFormat *output, const void *data, size_t len, char *label) {
+	struct OptarEncoder *encoder = optar_encoder_create(format, output, label, len);
+	optar_encoder_feed(encoder, data, len);
+
+	int pages = optar_encoder_finish(encoder);
+	optar_encoder_destroy(encoder);
+
+	return pages;
+}
+
+int optar_file_parallel(struct PageFormat *format, struct OutputFormat *output, char *input_filename, char *output_basename, unsigned int jobs) {
+	FILE *input_stream = open_input(input_filename);
+	unsigned long long length = input_length(input_stream, input_filename);
+
+	/* The workers reopen the input and seek to their pages */
+	if(input_stream == stdin || length == OPTAR_UNKNOWN_LENGTH) {
+		return encode_stream(format, output, input_stream, length, output_basename);
+	}
+
+	struct EncodeJob job = {
+		.format = format,
+		.output = output,
+		.input_filename = input_filename,
+		.output_basename = output_basename,
+		.input_length = length
+	};
+	fclose(input_stream);
+
+	struct PageConstants constants;
+	compute_constants(&constants, format);
+	job.pages = (job.input_length + constants.page_bytes - 1) / constants.page_bytes;
+	if(!job.pages) job.pages = 1; /* An empty input still gets its page */
+	if(output->type == OUTPUT_PDF) job.pdf = pdf_open(output, &constants, output_basename, 0);
+
+	pthread_t *threads = malloc(jobs * sizeof(*threads));
+	if(!threads) {
+		fprintf(stderr, "Cannot allocate encoding threads\n");
+		exit(1);
+	}
+	pthread_mutex_init(&job.lock, NULL);
+
+	for(unsigned int i = 0; i < jobs; i++) {
+		if(pthread_create(&threads[i], NULL, encode_worker, &job)) {
+			fprintf(stderr, "optar: cannot start encoding thread\n");
+			exit(1);
+		}
+	}
+	for(unsigned int i = 0; i < jobs; i++) pthread_join(threads[i], NULL);
+
+	pthread_mutex_destroy(&job.lock);
+	free(threads);
+	if(job.pdf) pdf_close(job.pdf);
+
+	return job.pages;
+}
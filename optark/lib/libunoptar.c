@@ -4,9 +4,12 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <math.h>
+#include <limits.h>
 #include <string.h> 
 #include <assert.h>
 #include <png.h>
+#include <pthread.h>
+#include <zlib.h>
 
 #include "lib.h"
 #include "parity.h"
@@ -15,92 +18,33 @@
 #define M_PI 3.14159265358979323846
 #endif
 
-/* Crosses will be resynced with precision of FINESTEP pixels */
-#define FINE_CROSS_RESYNC
-#define FINESTEP 0.25
 /* Define to disable repairing bit by Hamming codes */
 
+/* The pixel macros expect struct OptarDecoder *decoder in scope */
+
 /* Takes only unsigned integers, returns real value, if out of range returns
  * white, doens't threshold*/
 #define getpixu(x, y) \
-((x) >= width || (y) >= height ? 0xff : ary[(x) + (y) * width])
+((x) >= decoder->width || (y) >= decoder->height ? 0xff : decoder->ary[(x) + (y) * decoder->width])
 
 /* Integers in corners */
 #define writepix(x, y, c) writepixu((unsigned)floor(x), (unsigned)floor(y), c)
 /* If out of range, doesn't write anythinig. Integers are in pixel upper
  * left corners. */
-#define writepixu(x, y, c) {if ((x) < width && (y) < height) \
-	newary[(x) + (y) * width] = c;}
-
+#define writepixu(x, y, c) {if ((x) < decoder->width && (y) < decoder->height) \
+	decoder->newary[(x) + (y) * decoder->width] = c;}
 
-struct PageConstants unoptarconstants;
 
-struct Que {
-	unsigned x;
-	unsigned y;
-};
+/* These macros shift coordinates by given amount of input pixels parallel
+ * with recording axes. Expect decoder in scope too. */
+#define PSHIFTX(x, dx, dy) ((x) + (dx) * decoder->pixelhx + (dy) * decoder->pixelvx)
+#define PSHIFTY(y, dx, dy) ((y) + (dx) * decoder->pixelhy + (dy) * decoder->pixelvy)
 
-static unsigned width, height; /* In pixels, not it symbols! The whole image including
-			   border, white surrounding etc. */
-static unsigned char *ary; /* Allocated to width*height */
-static unsigned char *newary; /* Allocated to width*height */
-
-static unsigned long histogram[256];
-static unsigned char global_cutlevel;
-static unsigned char fill_global_cutlevel; /* This is always set to 50% between
-					      black and white to make sure the
-					      border is not accidentally broken
-					      through as happened when
-					      global_cutlevel was used for
-					      filling. */
-static unsigned char average; /* Average pixel value */
-static unsigned long corners[4][2]; /* UL, UR, LL, LR / x, y. Integers in pixel upper
-			   left corners. */
-static unsigned long leftedge, rightedge, topedge, bottomedge; /* Coordinates,
-	minima/maxima of the corner coordinates. */
-double ***crosses; //[unoptarconstants.format->xcrosses][unoptarconstants.format->ycrosses][2]; [x][y][coord]. Integers in pixel upper left corners.
-float **cutlevels; //[unoptarconstants.format->xcrosses][unoptarconstants.format->ycrosses]; Each cross has it's own cutlevel based on how it came out printed.
-static int chalf_fine; /* Larger chalf for fine search */
-static int chalf; /* In the input image, measured in input image pixels!
-		   Important difference - in the decoding, the crosses are
-		   assumed twice as small!
-
-		   Calculated by find_corners. */
-static float *search_area; /* Allocated as soon as chalf is known. Width 4*chalf+1,
-		       height 4*chalf+1. The additional "+1" is for a row
-		       (topmost) and column (leftmost) of zeroes which are
-		       a result of integration.
-
-		       Before integration, position x,y (1...4*chalf) says
-		       pixel value, where the middle of the cross is
-		       just at the boundary between pixels [2*chalf] and
-		       [2*chalf+1].
-		       After integration, each pixel says integral including
-		       that pixel. */
-
-static unsigned long bad_01, bad_10; /* Flipped from 0 to 1 (black dirt),
-					flipped from 1 to 0 (white dirt) */
-static unsigned long bad_total;
-static unsigned long irreparable;
+/* Index of cross cx, cy in crosses and cutlevels */
+#define CROSS(decoder, cx, cy) ((cx) * (decoder)->constants.format->ycrosses + (cy))
 
-/* These macros shift coordinates by given amount of input pixels parallel
- * with recording axes. */
-#define PSHIFTX(x, dx, dy) ((x) + (dx) * pixelhx + (dy) * pixelvx)
-#define PSHIFTY(y, dx, dy) ((y) + (dx) * pixelhy + (dy) * pixelvy)
-
-static double pixelhx, pixelhy, pixelvx, pixelvy; /* Horizontal (right) and vertical
-(down) pixel vectors.They are initialized as soon as the corners are determined
-and their length is equal to 1.  Used to compensate out rotation. System:
-+x right, +y down */
-static double hpixel, vpixel; /* Pixel size calculated from the horizontal
-			 and vertical corner distance */
-static struct Que *que;
-static struct Que *que_end; /* First invalid */
-static struct Que *rptr, *wptr;
-static FILE *input_stream;
 static double output_gamma = 0.454545; /* What gamma the debug output has
 			      (output number=number of photons ^ gamma) */
-static unsigned long golay_stats[5]; /* 0, 1, 2, 3, 4 damaged bits */
 
 /* -------------------- MAGIC CONSTANTS -------------------- */
 static double unsharp_mask = 7 /* 0.7 */; 
@@ -119,8 +63,8 @@ static double minmax_filter = 0.5; /* Dust/scratch removal filter. The input pix
 static double pixel_blur = 0.25; /*0.155  Approximate width of blur blot in terms of input
 			    pixel. */
 static double cross_trim = 0.75; /* Such amount of input pixels (the big ones) will be
-			   trimmed from the cross prior to performing the fine
-			   search. */
+			   trimmed from the cross when measuring its
+			   cutlevel. */
 /* -------------------- END OF MAGIC CONSTANTS -------------------- */
 
 /* Allocates and fills in gamma table */
@@ -140,11 +84,11 @@ static unsigned char *make_gamma_table(float gamma) {
 	return t;
 }
 
-static void dump_newary(char *fname) {
+static void dump_newary(struct OptarDecoder *decoder, char *fname) {
 	unsigned char *gamma_table = make_gamma_table(output_gamma);
 	/* Translate from linear photometric back to gamma compressed. The
 	 * output file will have the same gamma as the input one. */
-	for(unsigned char *ptr = newary; ptr < newary + width * height; ptr++) *ptr = gamma_table[*ptr];
+	for(unsigned char *ptr = decoder->newary; ptr < decoder->newary + decoder->width * decoder->height; ptr++) *ptr = gamma_table[*ptr];
 	free(gamma_table);
 
 	FILE *f = fopen(fname, "w");
@@ -156,35 +100,35 @@ static void dump_newary(char *fname) {
 	fprintf(f,"P5\n"
 		"%u %u\n"
 		"255\n",
-		width, height);
+		decoder->width, decoder->height);
 
-	fwrite(newary, width, height, f);
+	fwrite(decoder->newary, decoder->width, decoder->height, f);
 	fclose(f);
 }
 
 /* Gamma corrects to photon counts and calculates histogram of the gamma
  * corrected image. */
-static void calc_histogram(void) {
-	unsigned char *end = ary + (unsigned long)width * height;
+static void calc_histogram(struct OptarDecoder *decoder) {
+	unsigned char *end = decoder->ary + (unsigned long)decoder->width * decoder->height;
 	unsigned long long total = 0;
 
-	memset(histogram, 0, sizeof(histogram));
-	for(unsigned char *ptr = ary; ptr < end; ptr++){
-		histogram[*ptr]++;
+	memset(decoder->histogram, 0, sizeof(decoder->histogram));
+	for(unsigned char *ptr = decoder->ary; ptr < end; ptr++){
+		decoder->histogram[*ptr]++;
 	}
 
 	/* Calculate the sum of the histogram */
 	{
-		for(int i = 0; i < sizeof(histogram) / sizeof(*histogram); i++)
-			total += (unsigned long long)i * histogram[i];
+		for(int i = 0; i < sizeof(decoder->histogram) / sizeof(*decoder->histogram); i++)
+			total += (unsigned long long)i * decoder->histogram[i];
 	}
 
-	average = (total + ((width * height) >> 1)) / (width * height);
-	fprintf(stderr, "Average pixel value %u\n", average);
+	decoder->average = (total + ((decoder->width * decoder->height) >> 1)) / (decoder->width * decoder->height);
+	fprintf(stderr, "Average pixel value %u\n", decoder->average);
 }
 
 /* Analyzes, determines the cut level */
-static void analyze_cutlevel(void) {
+static void analyze_cutlevel(struct OptarDecoder *decoder) {
 	float white, black;
 	unsigned long black_pixels, white_pixels;
 	float white_rms, black_rms; /* At the end they will be RMS of the
@@ -193,21 +137,21 @@ static void analyze_cutlevel(void) {
 	
 	int lastcutlevel;
 
-	fill_global_cutlevel = global_cutlevel = average;
+	decoder->fill_global_cutlevel = decoder->global_cutlevel = decoder->average;
 
 	int iter; /* max. MAXITER iterations */
 	/* The second guess uses global_cutlevel from the first guess */
 	for(iter = 0; iter < MAXITER; iter++) {
-		lastcutlevel = global_cutlevel;
+		lastcutlevel = decoder->global_cutlevel;
 		white_rms = black_rms = 0;
 		black_pixels = white_pixels = 0;
-		for(int i = 0; i < global_cutlevel; i++) {
-			black_rms += (float)histogram[i] * (global_cutlevel - i) * (global_cutlevel - i);
-			black_pixels += histogram[i];
+		for(int i = 0; i < decoder->global_cutlevel; i++) {
+			black_rms += (float)decoder->histogram[i] * (decoder->global_cutlevel - i) * (decoder->global_cutlevel - i);
+			black_pixels += decoder->histogram[i];
 		}
-		for(int i = global_cutlevel + 1; i < sizeof(histogram) / sizeof(*histogram); i++) {
-			white_rms += (float)histogram[i] * (i - global_cutlevel) * (i - global_cutlevel);
-			white_pixels += histogram[i];
+		for(int i = decoder->global_cutlevel + 1; i < sizeof(decoder->histogram) / sizeof(*decoder->histogram); i++) {
+			white_rms += (float)decoder->histogram[i] * (i - decoder->global_cutlevel) * (i - decoder->global_cutlevel);
+			white_pixels += decoder->histogram[i];
 		}
 
 		/* Convert square sums to mean square */
@@ -218,53 +162,141 @@ static void analyze_cutlevel(void) {
 		white_rms = sqrt(white_rms);
 		black_rms = sqrt(black_rms);
 
-		white = global_cutlevel + white_rms;
-		black = global_cutlevel - black_rms;
+		white = decoder->global_cutlevel + white_rms;
+		black = decoder->global_cutlevel - black_rms;
 
 		/* Cutlevel determined by sync_white_cut. sync_white_cut=0 means
 		 * cut at black level, 0.5 cut in the middle, 1 cut at the
 		 * white level */
-		global_cutlevel = floor(white * sync_white_cut + black * (1 - sync_white_cut) + 0.5);
-		fill_global_cutlevel = floor(white * 0.5 + black * 0.5 + 0.5);
+		decoder->global_cutlevel = floor(white * sync_white_cut + black * (1 - sync_white_cut) + 0.5);
+		decoder->fill_global_cutlevel = floor(white * 0.5 + black * 0.5 + 0.5);
 		fprintf(stderr,"Black %G, white %G, "
 			"cutlevel %u (0x%02x), "
 			"fill cutlevel %u (0x%02x)\n",
 			black, white,
-			global_cutlevel, global_cutlevel,
-			fill_global_cutlevel, fill_global_cutlevel
+			decoder->global_cutlevel, decoder->global_cutlevel,
+			decoder->fill_global_cutlevel, decoder->fill_global_cutlevel
 		);
-		if(global_cutlevel == lastcutlevel) break; /* Stable state reached */
+		if(decoder->global_cutlevel == lastcutlevel) break; /* Stable state reached */
 	}
 	if(iter==MAXITER) fprintf(stderr," Warning: cutting point analysis didn't converge in %u iterations.\n", MAXITER);
 }
 
-/* xin, yin are coordinates of the starting
- * corner. dx is which way to go away from the corner horizontally and
- * dy vertically. *outx, *outy will contain the address of the first black pixel
- * or (-1, -1) if none is found. */
-static void diag_scan(int *outx, int *outy, int xin, int yin, int dx, unsigned int dy) {
-	int xbegin, x, y;
-	unsigned int ctr, len;
-
-	for(xbegin = xin, len = 1; xbegin < MIN(width, height); xbegin += dx, len++) {
-		x = xbegin;
-		y = yin;
-		for(ctr = len; ctr; ctr--, x -= dx, y += dy) {
-			if(getpixu(x, y) < global_cutlevel) {
-				*outx = x;
-				*outy = y;
-				return;
-			}
+/* Fills the levels of pyramid from ary: every one holds the minimum of 4x4
+ * blocks of the one below */
+static void build_pyramid(struct OptarDecoder *decoder) {
+	const unsigned char *below = decoder->ary;
+	unsigned int width = decoder->width, height = decoder->height;
+
+	for(int level = 0; level < PYRAMID_LEVELS; level++) {
+		unsigned int w = (width + 3) >> 2, h = (height + 3) >> 2;
+		unsigned char *ptr = malloc((unsigned long)w * h);
+		if(!ptr) {
+			fprintf(stderr, "Cannot allocate the image pyramid.\n");
+			exit(1);
+		}
+		memset(ptr, 0xff, (unsigned long)w * h);
+
+		for(unsigned int y = 0; y < height; y++) {
+			const unsigned char *src = below + (unsigned long)y * width;
+			unsigned char *dest = ptr + (unsigned long)(y >> 2) * w;
+			for(unsigned int x = 0; x < width; x++) dest[x >> 2] = MIN(dest[x >> 2], src[x]);
 		}
+
+		decoder->pyramid[level] = ptr;
+		decoder->pyramid_width[level] = w;
+		decoder->pyramid_height[level] = h;
+		below = ptr;
+		width = w;
+		height = h;
 	}
-	*outx =- 1;
-	*outy =- 1;
+}
+
+static void free_pyramid(struct OptarDecoder *decoder) {
+	for(int level = 0; level < PYRAMID_LEVELS; level++) {
+		free(decoder->pyramid[level]);
+		decoder->pyramid[level] = NULL;
+	}
+}
+
+/* The dark pixel closest to the corner of a diag_scan */
+struct CornerHit {
+	long distance; /* |x - xin| + |y - yin| */
+	long side; /* |y - yin| */
+	int x, y;
+};
+
+/* Looks for a better hit in block bx, by of pyramid level, level -1 being
+ * the pixels themselves. A block is skipped if it has no dark pixel or all
+ * of them are further than the hit. */
+static void corner_block(struct OptarDecoder *decoder, int level, int bx, int by, int xin, int yin, struct CornerHit *hit) {
+	int shift = 2 * (level + 1);
+	long x0 = (long)bx << shift, y0 = (long)by << shift;
+	long x1 = MIN(x0 + (1L << shift), decoder->width) - 1, y1 = MIN(y0 + (1L << shift), decoder->height) - 1;
+	long nearx = MAX(x0, MIN(x1, xin)), neary = MAX(y0, MIN(y1, yin));
+
+	if(labs(nearx - xin) + labs(neary - yin) > hit->distance) return;
+
+	if(level < 0) {
+		long distance = labs(bx - xin) + labs(by - yin), side = labs(by - yin);
+		if(getpixu(bx, by) >= decoder->global_cutlevel) return;
+		if(distance < hit->distance || (distance == hit->distance && side < hit->side)) {
+			hit->distance = distance;
+			hit->side = side;
+			hit->x = bx;
+			hit->y = by;
+		}
+		return;
+	}
+
+	if(decoder->pyramid[level][(unsigned long)by * decoder->pyramid_width[level] + bx] >= decoder->global_cutlevel) return;
+
+	unsigned int w = level ? decoder->pyramid_width[level - 1] : decoder->width;
+	unsigned int h = level ? decoder->pyramid_height[level - 1] : decoder->height;
+	for(int y = by << 2; y < MIN((by << 2) + 4, (int)h); y++) {
+		for(int x = bx << 2; x < MIN((bx << 2) + 4, (int)w); x++) {
+			corner_block(decoder, level - 1, x, y, xin, yin, hit);
+		}
+	}
+}
+
+/* Finds the dark pixel closest to xin, yin on the diagonals going dx, dy
+ * from there, in the order the diagonals are walked pixel by pixel: the
+ * closest one, and of those the one closest in y. The diagonals are taken
+ * through the pyramid rather than pixel by pixel, walking the blocks of its
+ * top level by their own diagonals until they can't be any closer, and
+ * going down only into the blocks with a dark pixel. *outx, *outy get
+ * (-1, -1) if none is found. */
+static void diag_scan(struct OptarDecoder *decoder, int *outx, int *outy, int xin, int yin, int dx, int dy) {
+	struct CornerHit hit = {.distance = LONG_MAX};
+	int top = PYRAMID_LEVELS - 1, shift = 2 * PYRAMID_LEVELS;
+	int w = decoder->pyramid_width[top], h = decoder->pyramid_height[top];
+	int bxin = xin >> shift, byin = yin >> shift;
+
+	/* Diagonal k of blocks starts (k - 2) blocks away from the corner */
+	for(long k = 0; k <= w + h && (k - 2) * (1L << shift) <= hit.distance; k++) {
+		for(long i = 0; i <= k; i++) {
+			long bx = bxin + i * dx, by = byin + (k - i) * dy;
+			if(bx < 0 || bx >= w || by < 0 || by >= h) continue;
+			corner_block(decoder, top, bx, by, xin, yin, &hit);
+		}
+	}
+
+	/* The walk stops after as many diagonals as the image is wide or
+	 * high, and the one going left doesn't start if it's wider than high */
+	if(hit.distance >= MIN(decoder->width, decoder->height) || (dx < 0 && decoder->width > decoder->height)) {
+		*outx = -1;
+		*outy = -1;
+		return;
+	}
+	*outx = hit.x;
+	*outy = hit.y;
 }
 
 /* Protection against buffer overrun. The coordinate is the coordinate of
  * the mark center in a system where integers are in pixel upper left
  * corners. Upper left pixel of the mark will be white. */
-static void mark(double x, double y) {
+static void mark(struct OptarDecoder *decoder, double x, double y) {
 	unsigned xu, yu;
 	xu = floor(x + 0.5);
 	yu = floor(y + 0.5);
@@ -302,111 +334,106 @@ static double normalize_angle(double a) {
 	return remainder(a, 360);
 }
 
-static void find_corners(void) {
+static void find_corners(struct OptarDecoder *decoder) {
 	int x, y;
-	diag_scan(&x, &y, 0, 0, 1, 1);
+	diag_scan(decoder, &x, &y, 0, 0, 1, 1);
 
 	if(x < 0) {
 		static char failure[] = "failure_debug.pgm";
 		fprintf(stderr, "Error: cannot find upper left corner\n");
 fail:
 		fprintf(stderr, "See failure_debug.pgm why.\n");
-		memcpy(newary, ary, (unsigned long)width * height);
-		dump_newary(failure);
+		memcpy(decoder->newary, decoder->ary, (unsigned long)decoder->width * decoder->height);
+		dump_newary(decoder, failure);
 		exit(1);
 	}
-	corners[0][0] = x;
-	corners[0][1] = y;
+	decoder->corners[0][0] = x;
+	decoder->corners[0][1] = y;
 
-	diag_scan(&x, &y, width - 1, 0, -1, 1);
+	diag_scan(decoder, &x, &y, decoder->width - 1, 0, -1, 1);
 	if(x < 0) {
 		fprintf(stderr, "Error: cannot find upper right corner\n");
 		goto fail;
 	}
-	corners[1][0] = x + 1;
-	corners[1][1] = y;
+	decoder->corners[1][0] = x + 1;
+	decoder->corners[1][1] = y;
 
-	diag_scan(&x, &y, 0, height - 1, 1, -1);
+	diag_scan(decoder, &x, &y, 0, decoder->height - 1, 1, -1);
 	if(x < 0) {
 		fprintf(stderr, "Error: cannot find lower left corner\n");
 		goto fail;
 	}
-	corners[2][0] = x;
-	corners[2][1] = y + 1;
+	decoder->corners[2][0] = x;
+	decoder->corners[2][1] = y + 1;
 
-	diag_scan(&x, &y, width - 1, height - 1, -1, -1);
+	diag_scan(decoder, &x, &y, decoder->width - 1, decoder->height - 1, -1, -1);
 	if(x < 0) {
 		fprintf(stderr, "Error: cannot find lower right corner\n");
 		goto fail;
 	}
-	corners[3][0] = x + 1;
-	corners[3][1] = y + 1;
+	decoder->corners[3][0] = x + 1;
+	decoder->corners[3][1] = y + 1;
+	free_pyramid(decoder);
 
-	leftedge = MIN(corners[0][0], corners[2][0]);
-	rightedge = MAX(corners[1][0], corners[3][0]);
-	topedge = MIN(corners[0][1], corners[1][1]);
-	bottomedge = MAX(corners[2][1], corners[3][1]);
+	decoder->leftedge = MIN(decoder->corners[0][0], decoder->corners[2][0]);
+	decoder->rightedge = MAX(decoder->corners[1][0], decoder->corners[3][0]);
+	decoder->topedge = MIN(decoder->corners[0][1], decoder->corners[1][1]);
+	decoder->bottomedge = MAX(decoder->corners[2][1], decoder->corners[3][1]);
 
-	hpixel = (corners[1][0] + corners[3][0] - corners[0][0] - corners[0][0]) / 2.0 / unoptarconstants.width;
-	vpixel = (corners[2][1] + corners[3][1] - corners[0][1] - corners[1][1]) / 2.0 / unoptarconstants.height;
-	fprintf(stderr, "One bit is %G horizontal pixels and %G vertical pixels.\n", hpixel, vpixel);
+	decoder->hpixel = (decoder->corners[1][0] + decoder->corners[3][0] - decoder->corners[0][0] - decoder->corners[0][0]) / 2.0 / decoder->constants.width;
+	decoder->vpixel = (decoder->corners[2][1] + decoder->corners[3][1] - decoder->corners[0][1] - decoder->corners[1][1]) / 2.0 / decoder->constants.height;
+	fprintf(stderr, "One bit is %G horizontal pixels and %G vertical pixels.\n", decoder->hpixel, decoder->vpixel);
 
 	{
 		/* Take only half to prevent spurious resync to an edge of the
 		 * cross when the data mimic the other half of the cross. */
-		unsigned int hchalf = hpixel * unoptarconstants.format->chalf * 0.5;
-		unsigned int vchalf = vpixel * unoptarconstants.format->chalf * 0.5;
+		unsigned int hchalf = decoder->hpixel * decoder->constants.format->chalf * 0.5;
+		unsigned int vchalf = decoder->vpixel * decoder->constants.format->chalf * 0.5;
 
-		chalf = MIN(hchalf, vchalf); 
+		decoder->chalf = MIN(hchalf, vchalf); 
 		/* Round to zero to make sure we don't catch any chaff */
-
-		/* Trim the cross by some fraction of input pixel to remove
-		 * the area affected by crosstalk. */
-		hchalf = hpixel * (unoptarconstants.format->chalf - cross_trim);
-		vchalf = vpixel * (unoptarconstants.format->chalf - cross_trim);
-
-		chalf_fine = MIN(hchalf, vchalf);
 	}
+	decoder->search_radius = decoder->chalf;
 	
 	/* Calculate the pixel vectors */
-	pixelhx=((double)corners[1][0] + (double)corners[3][0]
-		   - (double)corners[0][0] - (double)corners[2][0]) / 2;
-	pixelhy=((double)corners[1][1] + (double)corners[3][1]
-		   - (double)corners[0][1] - (double)corners[2][1]) / 2;
-	pixelvx=((double)corners[2][0] + (double)corners[3][0]
-		   - (double)corners[0][0] - (double)corners[1][0]) / 2;
-	pixelvy=((double)corners[2][1] + (double)corners[3][1]
-		   - (double)corners[0][1] - (double)corners[1][1]) / 2;
+	decoder->pixelhx=((double)decoder->corners[1][0] + (double)decoder->corners[3][0]
+		   - (double)decoder->corners[0][0] - (double)decoder->corners[2][0]) / 2;
+	decoder->pixelhy=((double)decoder->corners[1][1] + (double)decoder->corners[3][1]
+		   - (double)decoder->corners[0][1] - (double)decoder->corners[2][1]) / 2;
+	decoder->pixelvx=((double)decoder->corners[2][0] + (double)decoder->corners[3][0]
+		   - (double)decoder->corners[0][0] - (double)decoder->corners[1][0]) / 2;
+	decoder->pixelvy=((double)decoder->corners[2][1] + (double)decoder->corners[3][1]
+		   - (double)decoder->corners[0][1] - (double)decoder->corners[1][1]) / 2;
 
 	/* Normalize the horizontal vector (which may not be exactly
 	 * horizontal */
-	normalize_vector(&pixelhx, &pixelhy);
+	normalize_vector(&decoder->pixelhx, &decoder->pixelhy);
 	/* Normalize the vertical vector (which may not be exactly
 	 * vertical */
-	normalize_vector(&pixelvx, &pixelvy);
+	normalize_vector(&decoder->pixelvx, &decoder->pixelvy);
 	fprintf(stderr, "Input horizontal pixel vector %G,%G, vertical %G,%G. skew %G deg, perpendicularity %G deg.\n",
-			pixelhx, pixelhy, pixelvx, pixelvy,
-			normalize_angle(angle(pixelhx, -pixelhy) + angle(pixelvx, -pixelvy) + 90) / 2,
-			angle(pixelhx, -pixelhy) - angle(pixelvx, -pixelvy)
+			decoder->pixelhx, decoder->pixelhy, decoder->pixelvx, decoder->pixelvy,
+			normalize_angle(angle(decoder->pixelhx, -decoder->pixelhy) + angle(decoder->pixelvx, -decoder->pixelvy) + 90) / 2,
+			angle(decoder->pixelhx, -decoder->pixelhy) - angle(decoder->pixelvx, -decoder->pixelvy)
 	);
 
 	{
-		unsigned long bytes = (long)(4 * chalf + 1) * (4 * chalf + 1) * sizeof(*search_area);
-		search_area = malloc(bytes);
-		if(!search_area) {
+		unsigned long bytes = (long)(4 * decoder->chalf + 1) * (4 * decoder->chalf + 1) * sizeof(*decoder->search_area);
+		decoder->search_area = malloc(bytes);
+		if(!decoder->search_area) {
 			fprintf(stderr, "Cannot allocate search area of %lu bytes\n", bytes);
 			exit(1);
 		}
 	}
 
-	fprintf(stderr, "Allocating search area of %u x %u (%u) pixels.\n", chalf << 1, chalf << 1, (chalf * chalf) << 2);
+	fprintf(stderr, "Allocating search area of %u x %u (%u) pixels.\n", decoder->chalf << 1, decoder->chalf << 1, (decoder->chalf * decoder->chalf) << 2);
 
 	fprintf(stderr,"Upper corners at %lu, %lu and %lu, %lu,\n"
 		"lower corners at %lu, %lu and %lu, %lu.\n"
 		"Cross half for searching is %d x %d input pixels.\n",
-		corners[0][0], corners[0][1], corners[1][0], corners[1][1],
-		corners[2][0], corners[2][1], corners[3][0], corners[3][1],
-		chalf, chalf);
+		decoder->corners[0][0], decoder->corners[0][1], decoder->corners[1][0], decoder->corners[1][1],
+		decoder->corners[2][0], decoder->corners[2][1], decoder->corners[3][0], decoder->corners[3][1],
+		decoder->chalf, decoder->chalf);
 
 }
 
@@ -425,7 +452,7 @@ static float bilinearf(float ul, float ur, float ll, float lr, float hpar, float
 }
 
 /* x,y with integers in centers of pixels */
-static float get_pixel_interp(double x, double y) {
+static float get_pixel_interp(struct OptarDecoder *decoder, double x, double y) {
 	unsigned xi, yi; /* Integer versions, rounded down */
 
 	/* Supports even extrapolation, but should be never necessary */
@@ -439,131 +466,118 @@ static float get_pixel_interp(double x, double y) {
 }
 
 /* Samples pixels and performs correction(s) */
-static float pixel_correct_sample(double x, double y) {
-	double hdist = hpixel * unsharp_dist;
-	double vdist = vpixel * unsharp_dist;
+static float pixel_correct_sample(struct OptarDecoder *decoder, double x, double y) {
+	double hdist = decoder->hpixel * unsharp_dist;
+	double vdist = decoder->vpixel * unsharp_dist;
 
 	/* First sum, later average */
-	float avg = get_pixel_interp(
+	float avg = get_pixel_interp(decoder,
 		PSHIFTX(x, -hdist, 0),
 		PSHIFTY(y, -hdist, 0));
-	avg += get_pixel_interp(
+	avg += get_pixel_interp(decoder,
 		PSHIFTX(x, hdist, 0),
 		PSHIFTY(y, hdist, 0));
-	avg += get_pixel_interp(
+	avg += get_pixel_interp(decoder,
 		PSHIFTX(x, 0, vdist),
 		PSHIFTY(y, 0, vdist));
-	avg += get_pixel_interp(
+	avg += get_pixel_interp(decoder,
 		PSHIFTX(x, 0, -vdist),
 		PSHIFTY(y, 0, -vdist));
 	avg /= 4;
 
 
-	float val = get_pixel_interp(x, y);
+	float val = get_pixel_interp(decoder, x, y);
 	val += unsharp_mask * (val - avg); /* Emphasize the distance from average */
 	return val;
 }
 
 /* Returns difference from global_cutlevel. Integers in centers of pixels. Interpolates
  * for nonintegral coordinates. */
-static float diffpix(double x, double y) {
-	return get_pixel_interp(x, y) - global_cutlevel;
-}
-
-/* Calculates a correlation with a cross. x and y are coords of the cross
- * center with integers in UL corners of pixels. */
-static float cross_correl(double x, double y) {
-	/* -0.5 for conversion corners -> centers, +0.5 for conversion
-	 * cross center -> sample point 1/2 pixel away from the cross
-	 * center -> No addition at all */
-	float sum = 0;
-	for(double dx = 0; dx < chalf_fine; dx++) {
-		for(double dy = 0; dy < chalf_fine; dy++) {
-			sum -= diffpix(x + dx, y + dy);
-			sum -= diffpix(x - 1 - dx, y - 1 - dy);
-			sum += diffpix(x + dx, y - 1 - dy);
-			sum += diffpix(x - 1 - dx, y + dy);
-		}
-	}
-
-	return sum;
+static float diffpix(struct OptarDecoder *decoder, double x, double y) {
+	return get_pixel_interp(decoder, x, y) - decoder->global_cutlevel;
 }
 
-/* Range from 0 to 4*chalf, inclusive */
-static float getsearch(int xpos, int ypos) {
+/* Side of the search area, 4*chalf+1 for the full search_radius */
+#define SEARCH_SIDE(decoder) (2 * ((decoder)->chalf + (decoder)->search_radius) + 1)
+
+/* Range from 0 to SEARCH_SIDE-1, inclusive */
+static float getsearch(struct OptarDecoder *decoder, const float *area, int xpos, int ypos) {
 	assert(xpos >= 0);
-	assert(xpos <= 4 * chalf);
+	assert(xpos < SEARCH_SIDE(decoder));
 	assert(ypos >= 0);
-	assert(ypos <= 4 * chalf);
+	assert(ypos < SEARCH_SIDE(decoder));
 
-	return search_area[ypos * (4 * chalf + 1) + xpos];
+	return area[ypos * SEARCH_SIDE(decoder) + xpos];
 }
 
 /* xpos says the cross offset. 0,0 means at the original position from around
- * which the search_area was loaded. The range is -chalf to chalf
- * (inclusive). The input must be in that range, otherwise crash */
-static float cross_correl_search(int xpos, int ypos) {
+ * which the search area was loaded. The range is -search_radius to
+ * search_radius (inclusive). The input must be in that range, otherwise
+ * crash */
+static float cross_correl_search(struct OptarDecoder *decoder, const float *area, int xpos, int ypos) {
 	float sum;
 
-	assert(xpos >= -chalf);
-	assert(xpos <= chalf);
-	assert(ypos >= -chalf);
-	assert(ypos <= chalf);
+	assert(xpos >= -decoder->search_radius);
+	assert(xpos <= decoder->search_radius);
+	assert(ypos >= -decoder->search_radius);
+	assert(ypos <= decoder->search_radius);
 
 	/* Normalize the xpos and ypos to mean the cross center in array
-	 * indices. 0 means array left edge, 2*chalf array center, 4*chalf array
-	 * right edge. */
+	 * indices. 0 means array left edge, chalf+search_radius array center,
+	 * SEARCH_SIDE-1 array right edge. */
 
-	xpos += 2 * chalf;
-	ypos += 2 * chalf;
+	xpos += decoder->chalf + decoder->search_radius;
+	ypos += decoder->chalf + decoder->search_radius;
 
 	/* Center */
-	sum = -4 * getsearch(xpos, ypos);
+	sum = -4 * getsearch(decoder, area, xpos, ypos);
 
 	/* Middles of sides */
 	sum += 2 * (
-		getsearch(xpos - chalf, ypos) +
-		getsearch(xpos + chalf, ypos) +
-		getsearch(xpos, ypos - chalf) +
-		getsearch(xpos, ypos + chalf)
+		getsearch(decoder, area, xpos - decoder->chalf, ypos) +
+		getsearch(decoder, area, xpos + decoder->chalf, ypos) +
+		getsearch(decoder, area, xpos, ypos - decoder->chalf) +
+		getsearch(decoder, area, xpos, ypos + decoder->chalf)
 	);
 
 	/* Corners */
 	sum -= (
-		getsearch(xpos - chalf, ypos - chalf) +
-		getsearch(xpos - chalf, ypos + chalf) +
-		getsearch(xpos + chalf, ypos - chalf) +
-		getsearch(xpos + chalf, ypos + chalf)
+		getsearch(decoder, area, xpos - decoder->chalf, ypos - decoder->chalf) +
+		getsearch(decoder, area, xpos - decoder->chalf, ypos + decoder->chalf) +
+		getsearch(decoder, area, xpos + decoder->chalf, ypos - decoder->chalf) +
+		getsearch(decoder, area, xpos + decoder->chalf, ypos + decoder->chalf)
 	);
 
 	return sum;
 }
 
 /* After this, pixel [0][0] means integral from [0][0] to [1][1] (!), etc. */
-static void integrate_search_area(void) {
+static void integrate_search_area(struct OptarDecoder *decoder, float *area) {
 	/* Horizontal integration */
-	float *ptr = search_area;
-	for(int y = 0; y <= 4 * chalf; y++) {
+	int side = SEARCH_SIDE(decoder);
+	float *ptr = area;
+	for(int y = 0; y < side; y++) {
 		ptr++;
-		for(int x = 1; x <= 4 * chalf; x++) {
+		for(int x = 1; x < side; x++) {
 			ptr[0] += ptr[-1];
 			ptr++;
 		}
 	}
 
-	ptr = search_area + 4 * chalf + 1;
+	ptr = area + side;
 
 	/* Vertical integration */
-	for(; ptr < search_area + (4 * chalf + 1) * (4 * chalf + 1); ptr++) {
-		ptr[0] += ptr[-4 * chalf - 1];
+	for(; ptr < area + side * side; ptr++) {
+		ptr[0] += ptr[-side];
 	}
 }
 
-static void cross_stats(unsigned int cx, unsigned int cy) {
-	double centerx = crosses[cx][cy][0];
-	double centery = crosses[cx][cy][1];
-	int hpixelhalf = floor(hpixel * (unoptarconstants.format->chalf - cross_trim));
-	int vpixelhalf = floor(vpixel * (unoptarconstants.format->chalf - cross_trim));
+/* Sets the cutlevel of a cross from how it came out printed */
+static void cross_stats(struct OptarDecoder *decoder, unsigned int cx, unsigned int cy) {
+	double centerx = decoder->crosses[CROSS(decoder, cx, cy)][0];
+	double centery = decoder->crosses[CROSS(decoder, cx, cy)][1];
+	int hpixelhalf = floor(decoder->hpixel * (decoder->constants.format->chalf - cross_trim));
+	int vpixelhalf = floor(decoder->vpixel * (decoder->constants.format->chalf - cross_trim));
 
 	float black_rms = 0, white_rms = 0;
 	long val;
@@ -572,45 +586,44 @@ static void cross_stats(unsigned int cx, unsigned int cy) {
 
 	for(int xoff = -hpixelhalf; xoff <= hpixelhalf; xoff++) {
 		for(int yoff= -vpixelhalf; yoff <= vpixelhalf; yoff++) {
-			val = get_pixel_interp(
+			val = get_pixel_interp(decoder,
 				PSHIFTX(centerx, xoff, yoff),
 				PSHIFTY(centery, xoff, yoff)
 			);
 
-			if(val > global_cutlevel) {
+			if(val > decoder->global_cutlevel) {
 				/* White */
-				white_rms += (val - global_cutlevel) * (val - global_cutlevel);
+				white_rms += (val - decoder->global_cutlevel) * (val - decoder->global_cutlevel);
 				whitepixels++;
-			} else if(val < global_cutlevel) {
+			} else if(val < decoder->global_cutlevel) {
 				/* Black */
-				black_rms += (val - global_cutlevel) * (val - global_cutlevel);
+				black_rms += (val - decoder->global_cutlevel) * (val - decoder->global_cutlevel);
 				blackpixels++;
 			}
 		}
 	}
 
 	if(!(whitepixels && blackpixels)) {
-		cutlevel_result = global_cutlevel;
+		cutlevel_result = decoder->global_cutlevel;
 		/* Impossible to determine, use default global_cutlevel */
 	} else {
 		white_rms = sqrt(white_rms / whitepixels);
 		black_rms = sqrt(black_rms / blackpixels);
-		float white = global_cutlevel + white_rms;
-		float black = global_cutlevel - black_rms;
+		float white = decoder->global_cutlevel + white_rms;
+		float black = decoder->global_cutlevel - black_rms;
 		cutlevel_result = white * (white_cut) + black * (1 - white_cut);
 	}
-	cutlevels[cx][cy] = cutlevel_result;
-
-	fprintf(stderr,"%02x ", (int)floor(cutlevel_result + 0.5));
+	decoder->cutlevels[CROSS(decoder, cx, cy)] = cutlevel_result;
 }
 
 /* Center of search area is in a system where the integers are in the
  * corners. */
-static void load_search_area(double centerx, double centery) {
-	float *ptr = search_area;
-	for(int yoff = -2 * chalf - 1; yoff < 2 * chalf; yoff++) {
-		for(int xoff = -2 * chalf - 1; xoff < 2 * chalf; xoff++) {
-			if(yoff == -2 * chalf - 1 || xoff == -2 * chalf - 1) {
+static void load_search_area(struct OptarDecoder *decoder, float *area, double centerx, double centery) {
+	int half = decoder->chalf + decoder->search_radius;
+	float *ptr = area;
+	for(int yoff = -half - 1; yoff < half; yoff++) {
+		for(int xoff = -half - 1; xoff < half; xoff++) {
+			if(yoff == -half - 1 || xoff == -half - 1) {
 				/* Zero row/column */
 				*ptr = 0;
 			} else {
@@ -618,23 +631,65 @@ static void load_search_area(double centerx, double centery) {
 				 * in corners automatically translate to
 				 * centers of adjacent pixels expressed
 				 * in a system with integers in centers. */
-				*ptr = diffpix(PSHIFTX(centerx, xoff, yoff), PSHIFTY(centery, xoff, yoff));
+				*ptr = diffpix(decoder, PSHIFTX(centerx, xoff, yoff), PSHIFTY(centery, xoff, yoff));
 			}
 			ptr++;
 		}
 	}
 }
 
-/* The coords are with integers in corners */
-static void resync_cross(double *coordpair) {
+/* Where between the coarse search steps around xoff, yoff the correlation
+ * peaks, from a quadratic through the 3x3 correlations there. Each of xpeak
+ * and ypeak stays 0 if the surface isn't curved down that way or the search
+ * area ends there, and within half a step otherwise: further out it would
+ * have been the neighbouring step. */
+static void peak_fit(struct OptarDecoder *decoder, const float *area, int xoff, int yoff, double *xpeak, double *ypeak) {
+	int xfit = abs(xoff) < decoder->search_radius, yfit = abs(yoff) < decoder->search_radius;
+	float c = cross_correl_search(decoder, area, xoff, yoff);
+	double gx = 0, gy = 0, hxx = 0, hyy = 0, hxy = 0;
+
+	if(xfit) {
+		float l = cross_correl_search(decoder, area, xoff - 1, yoff);
+		float r = cross_correl_search(decoder, area, xoff + 1, yoff);
+		gx = (r - l) / 2;
+		hxx = r + l - 2 * c;
+	}
+	if(yfit) {
+		float u = cross_correl_search(decoder, area, xoff, yoff - 1);
+		float d = cross_correl_search(decoder, area, xoff, yoff + 1);
+		gy = (d - u) / 2;
+		hyy = d + u - 2 * c;
+	}
+	if(xfit && yfit) {
+		hxy = (cross_correl_search(decoder, area, xoff + 1, yoff + 1) - cross_correl_search(decoder, area, xoff + 1, yoff - 1)
+		     - cross_correl_search(decoder, area, xoff - 1, yoff + 1) + cross_correl_search(decoder, area, xoff - 1, yoff - 1)) / 4;
+	}
+
+	double det = hxx * hyy - hxy * hxy;
+	if(hxx < 0 && det > 0) {
+		/* Peak of the whole paraboloid */
+		*xpeak = (hxy * gy - hyy * gx) / det;
+		*ypeak = (hxy * gx - hxx * gy) / det;
+	} else {
+		/* Of the parabolas along the axes */
+		if(hxx < 0) *xpeak = -gx / hxx;
+		if(hyy < 0) *ypeak = -gy / hyy;
+	}
+	*xpeak = MAX(-0.5, MIN(0.5, *xpeak));
+	*ypeak = MAX(-0.5, MIN(0.5, *ypeak));
+}
+
+/* The coords are with integers in corners. area is a search area, see
+ * search_area. */
+static void resync_cross(struct OptarDecoder *decoder, float *area, double *coordpair) {
 	double xmax, ymax; /* Later it's calculated in which pixel position
 			      the maximum was calculated, with subpixel
 			      precision. Coords of cross center with integers
 			      in corners. */
 	float result;
 
-	load_search_area(coordpair[0], coordpair[1]);
-	integrate_search_area(); /* Precalculates - dynamic programming */
+	load_search_area(decoder, area, coordpair[0], coordpair[1]);
+	integrate_search_area(decoder, area); /* Precalculates - dynamic programming */
 
 	/* Step during which the maximum was reached */
 	/* Preload with a default */
@@ -642,48 +697,14 @@ static void resync_cross(double *coordpair) {
 	int yoffmax = 0;
 
 	/* How much was reached during maximum */
-	float max = cross_correl_search(xoffmax, yoffmax);
+	float max = cross_correl_search(decoder, area, xoffmax, yoffmax);
 
-	/* xoff, off - Symmetric step offsets for search stepping always
-	by 1 and once meaning 1, once meaning a subpixel
-	step. They perform steps parallel to the recording
+	/* xoff, yoff - Symmetric step offsets, parallel to the recording
 	axes. */
 	/* Rough search - 1 pixel step */
-	for(int xoff = -chalf; xoff <= chalf; xoff++) {
-		for(int yoff = -chalf; yoff <= chalf; yoff++){
-			result = cross_correl_search(xoff, yoff);
-			if(result > max) {
-				max = result;
-				xoffmax = xoff;
-				yoffmax = yoff;
-			}
-		}
-	}
-	xmax = PSHIFTX(coordpair[0], xoffmax, yoffmax);
-	ymax = PSHIFTY(coordpair[1], xoffmax, yoffmax);
-
-#ifdef FINE_CROSS_RESYNC
-#define HALFRANGE (0.5 / FINESTEP) /* 0.5 means 0.5 of small input pixel - no
-				    need to search more since then it would be
-				    caught by the neighbouring coarse search
-				    try. */
-	/* Load the fine search initial maximum position */
-	xoffmax = 0;
-	yoffmax = 0;
-
-	/* This must be here since cross_correl and cross_correl_search
-	 * return the result scaled by a different factor. */
-	max = cross_correl(xmax, ymax);
-
-	/* Fine search, FINESTEP pixels/ step. Counting in 0.25 steps */
-	for(int xoff = -HALFRANGE; xoff <= HALFRANGE; xoff++) {
-		for(int yoff = -HALFRANGE; yoff <= HALFRANGE; yoff++){
-			/* This is not using the search area anymore! */
-			result = cross_correl(
-				PSHIFTX(xmax, (double)xoff * FINESTEP,
-							  (double)yoff * FINESTEP),
-				PSHIFTY(ymax, (double)xoff * FINESTEP,
-							  (double)yoff * FINESTEP));
+	for(int xoff = -decoder->search_radius; xoff <= decoder->search_radius; xoff++) {
+		for(int yoff = -decoder->search_radius; yoff <= decoder->search_radius; yoff++){
+			result = cross_correl_search(decoder, area, xoff, yoff);
 			if(result > max) {
 				max = result;
 				xoffmax = xoff;
@@ -691,100 +712,539 @@ static void resync_cross(double *coordpair) {
 			}
 		}
 	}
-	/* Save the fine search result */
-	xmax = PSHIFTX(xmax, (double)xoffmax * FINESTEP, (double)yoffmax * FINESTEP);
-	ymax = PSHIFTY(ymax, (double)xoffmax * FINESTEP, (double)yoffmax * FINESTEP);
 
-#endif /* FINE_CROSS_RESYNC */
+	/* Fine search: the peak of a quadratic through the correlations
+	 * around the coarse maximum */
+	double xpeak = 0, ypeak = 0;
+	peak_fit(decoder, area, xoffmax, yoffmax, &xpeak, &ypeak);
+	xmax = PSHIFTX(coordpair[0], xoffmax + xpeak, yoffmax + ypeak);
+	ymax = PSHIFTY(coordpair[1], xoffmax + xpeak, yoffmax + ypeak);
 
 	/* Store the output */
 	coordpair[0] = xmax;
 	coordpair[1] = ymax;
 }
 
-static void sync_crosses(void) {
+/* Page pixel coordinates of the center of a cross, integers in corners */
+#define CROSS_U(decoder, cx) ((decoder)->constants.format->border + (decoder)->constants.format->chalf + (double)(cx) * (decoder)->constants.format->cpitch)
+#define CROSS_V(decoder, cy) ((decoder)->constants.format->border + (decoder)->constants.format->chalf + (double)(cy) * (decoder)->constants.format->cpitch)
+
+/* Every ANCHOR_STEP-th cross both ways, and the last ones, anchor the fit */
+#define ANCHOR_STEP 8
+/* Crosses a sync thread takes at once */
+#define SYNC_CHUNK 32
+/* More than one in this many seeded crosses off their seed and the page is
+ * synced from scratch */
+#define WARM_MISSES 8
+
+/* Maps page coordinates u, v to the input image through the projection h:
+ * x = (h0 u + h1 v + h2) / (h6 u + h7 v + 1) and y likewise with h3 to h5.
+ * Both sides are scaled to 0..1 to keep the fit well conditioned. */
+static void project(struct OptarDecoder *decoder, const double *h, double u, double v, double *x, double *y) {
+	u /= decoder->constants.width;
+	v /= decoder->constants.height;
+
+	double w = h[6] * u + h[7] * v + 1;
+	*x = (h[0] * u + h[1] * v + h[2]) / w * decoder->width;
+	*y = (h[3] * u + h[4] * v + h[5]) / w * decoder->height;
+}
+
+/* Least squares fit of h to n >= 4 points page[i] -> image[i]. Returns 0
+ * and leaves h alone if they don't determine it. */
+static int fit_projection(struct OptarDecoder *decoder, double *h, double (*page)[2], double (*image)[2], unsigned int n) {
+	double m[8][9] = {{0}}; /* Normal equations, right side in column 8 */
+
+	for(unsigned int i = 0; i < n; i++) {
+		double u = page[i][0] / decoder->constants.width, v = page[i][1] / decoder->constants.height;
+		double x = image[i][0] / decoder->width, y = image[i][1] / decoder->height;
+		double rows[2][9] = {
+			{u, v, 1, 0, 0, 0, -u * x, -v * x, x},
+			{0, 0, 0, u, v, 1, -u * y, -v * y, y}
+		};
+
+		for(int r = 0; r < 2; r++) {
+			for(int j = 0; j < 8; j++) {
+				for(int k = 0; k < 9; k++) m[j][k] += rows[r][j] * rows[r][k];
+			}
+		}
+	}
+
+	/* Gauss-Jordan with partial pivoting */
+	for(int j = 0; j < 8; j++) {
+		int pivot = j;
+		for(int r = j + 1; r < 8; r++) {
+			if(fabs(m[r][j]) > fabs(m[pivot][j])) pivot = r;
+		}
+		if(fabs(m[pivot][j]) < 1e-12) return 0;
+		for(int k = 0; k < 9; k++) {
+			double t = m[j][k];
+			m[j][k] = m[pivot][k];
+			m[pivot][k] = t;
+		}
+		for(int r = 0; r < 8; r++) {
+			if(r == j) continue;
+			double f = m[r][j] / m[j][j];
+			for(int k = j; k < 9; k++) m[r][k] -= f * m[j][k];
+		}
+	}
+	for(int j = 0; j < 8; j++) h[j] = m[j][8] / m[j][j];
+
+	return 1;
+}
+
+/* Shared by the threads of sync_run */
+struct SyncJob {
+	struct OptarDecoder *decoder;
+	const unsigned int *list; /* [n] Crosses as cx * ycrosses + cy */
+	unsigned int n;
+	unsigned int next; /* Next one to be taken */
+	int stats; /* Measure the cutlevels rather than resync */
+	pthread_mutex_t lock;
+};
+
+static void *sync_worker(void *arg) {
+	struct SyncJob *job = arg;
+	struct OptarDecoder *decoder = job->decoder;
+	unsigned int ycrosses = decoder->constants.format->ycrosses;
+	float *area = malloc((4 * decoder->chalf + 1) * (4 * decoder->chalf + 1) * sizeof(*area));
+	if(!area) {
+		fprintf(stderr, "Cannot allocate search area\n");
+		exit(1);
+	}
+
+	for(;;) {
+		pthread_mutex_lock(&job->lock);
+		unsigned int first = job->next;
+		job->next = MIN(first + SYNC_CHUNK, job->n);
+		pthread_mutex_unlock(&job->lock);
+		if(first >= job->n) break;
+
+		for(unsigned int i = first; i < MIN(first + SYNC_CHUNK, job->n); i++) {
+			unsigned int cx = job->list[i] / ycrosses, cy = job->list[i] % ycrosses;
+
+			if(job->stats) cross_stats(decoder, cx, cy);
+			else resync_cross(decoder, area, decoder->crosses[job->list[i]]);
+		}
+	}
+
+	free(area);
+	return NULL;
+}
+
+/* Resyncs the n crosses in list from where they are, or measures their
+ * cutlevels, on sync_jobs threads, or just this one if that's 0. They only read the image and each writes
+ * its own crosses. */
+static void sync_run(struct OptarDecoder *decoder, const unsigned int *list, unsigned int n, int stats) {
+	struct SyncJob job = {
+		.decoder = decoder,
+		.list = list,
+		.n = n,
+		.stats = stats
+	};
+	unsigned int helpers = MIN(MAX(decoder->sync_jobs, 1), n / SYNC_CHUNK + 1) - 1;
+	pthread_t threads[helpers + 1];
+
+	pthread_mutex_init(&job.lock, NULL);
+	for(unsigned int i = 0; i < helpers; i++) {
+		if(pthread_create(&threads[i], NULL, sync_worker, &job)) {
+			fprintf(stderr, "unoptar: cannot start cross sync thread\n");
+			exit(1);
+		}
+	}
+	sync_worker(&job);
+	for(unsigned int i = 0; i < helpers; i++) pthread_join(threads[i], NULL);
+	pthread_mutex_destroy(&job.lock);
+}
+
+static int compare_doubles(const void *a, const void *b) {
+	double x = *(const double *)a, y = *(const double *)b;
+	return (x > y) - (x < y);
+}
+
+/* Lists the anchor crosses, returns how many */
+static unsigned int list_anchors(struct OptarDecoder *decoder, unsigned int *list) {
+	unsigned int xcrosses = decoder->constants.format->xcrosses;
+	unsigned int ycrosses = decoder->constants.format->ycrosses;
+	unsigned int n = 0;
+
+	for(unsigned int cx = 0; cx < xcrosses; cx++) {
+		if(cx % ANCHOR_STEP && cx != xcrosses - 1) continue;
+		for(unsigned int cy = 0; cy < ycrosses; cy++) {
+			if(cy % ANCHOR_STEP && cy != ycrosses - 1) continue;
+			list[n++] = cx * ycrosses + cy;
+		}
+	}
+	return n;
+}
+
+/* Fits h to the n crosses in list, from from[cross] to where they are now,
+ * then once more without the ones which land more than limit off the fit:
+ * those caught something else. Returns how many crosses the last fit took,
+ * 0 if they didn't determine it. */
+static unsigned int fit_crosses(struct OptarDecoder *decoder, double *h, const unsigned int *list, unsigned int n, double (*from)[2], double limit) {
+	unsigned int fitted = 0;
+	double (*page)[2] = malloc(n * sizeof(*page));
+	double (*image)[2] = malloc(n * sizeof(*image));
+	if(!page || !image) {
+		fprintf(stderr, "Cannot allocate the cross fit\n");
+		exit(1);
+	}
+
+	for(int pass = 0; pass < 2; pass++) {
+		unsigned int m = 0;
+		for(unsigned int i = 0; i < n; i++) {
+			double *cross = decoder->crosses[list[i]];
+			double x, y;
+
+			if(pass) {
+				project(decoder, h, from[list[i]][0], from[list[i]][1], &x, &y);
+				if(hypot(cross[0] - x, cross[1] - y) > limit) continue;
+			}
+			page[m][0] = from[list[i]][0];
+			page[m][1] = from[list[i]][1];
+			image[m][0] = cross[0];
+			image[m][1] = cross[1];
+			m++;
+		}
+		if(m < 4 || !fit_projection(decoder, h, page, image, m)) break;
+		fitted = m;
+	}
+
+	free(page);
+	free(image);
+	return fitted;
+}
+
+/* Finds the crosses without going from one to the next, so they can be done
+ * in parallel: a projection fitted to the corners predicts the anchor
+ * crosses, the projection refitted to those predicts all the crosses, and a
+ * cross which then lands off from where its neighbours say is resynced
+ * again from there. */
+static void sync_crosses_model(struct OptarDecoder *decoder) {
+	unsigned int xcrosses = decoder->constants.format->xcrosses;
+	unsigned int ycrosses = decoder->constants.format->ycrosses;
+	unsigned int total = xcrosses * ycrosses;
+	/* Half a bit off from the fit or the neighbours is too much */
+	double limit = MAX(decoder->hpixel, decoder->vpixel) / 2;
+	double h[8];
+
+	unsigned int *list = malloc(total * sizeof(*list));
+	double (*page)[2] = malloc(total * sizeof(*page));
+	double (*image)[2] = malloc(total * sizeof(*image));
+	double (*shift)[2] = malloc(total * sizeof(*shift)); /* Resynced - predicted */
+	if(!list || !page || !image || !shift) {
+		fprintf(stderr, "Cannot allocate the cross model\n");
+		exit(1);
+	}
+
+	/* The corners */
+	for(int i = 0; i < 4; i++) {
+		page[i][0] = i & 1 ? decoder->constants.width : 0;
+		page[i][1] = i & 2 ? decoder->constants.height : 0;
+		image[i][0] = decoder->corners[i][0];
+		image[i][1] = decoder->corners[i][1];
+	}
+	if(!fit_projection(decoder, h, page, image, 4)) {
+		fprintf(stderr, "unoptar: the corners don't make a page\n");
+		exit(1);
+	}
+
+	/* The anchors, then a fit to them */
+	for(unsigned int i = 0; i < total; i++) {
+		page[i][0] = CROSS_U(decoder, i / ycrosses);
+		page[i][1] = CROSS_V(decoder, i % ycrosses);
+	}
+	unsigned int anchors = list_anchors(decoder, list);
+	for(unsigned int i = 0; i < anchors; i++) {
+		double *cross = decoder->crosses[list[i]];
+		project(decoder, h, page[list[i]][0], page[list[i]][1], cross, cross + 1);
+	}
+	sync_run(decoder, list, anchors, 0);
+	unsigned int fitted = fit_crosses(decoder, h, list, anchors, page, limit);
+	fprintf(stderr, "Page geometry fitted to %u of %u anchor crosses.\n", fitted, anchors);
+
+	/* All the crosses */
+	for(unsigned int i = 0; i < total; i++) {
+		double *cross = decoder->crosses[i];
+
+		project(decoder, h, page[i][0], page[i][1], cross, cross + 1);
+		shift[i][0] = cross[0];
+		shift[i][1] = cross[1];
+		list[i] = i;
+	}
+	sync_run(decoder, list, total, 0);
+	for(unsigned int i = 0; i < total; i++) {
+		shift[i][0] = decoder->crosses[i][0] - shift[i][0];
+		shift[i][1] = decoder->crosses[i][1] - shift[i][1];
+	}
+
+	/* The strays, against the median shift of their neighbours */
+	unsigned int strays = 0;
+	for(unsigned int i = 0; i < total; i++) {
+		int cx = i / ycrosses, cy = i % ycrosses;
+		double near[2][8];
+		unsigned int n = 0;
+
+		for(int nx = MAX(cx - 1, 0); nx <= MIN(cx + 1, (int)xcrosses - 1); nx++) {
+			for(int ny = MAX(cy - 1, 0); ny <= MIN(cy + 1, (int)ycrosses - 1); ny++) {
+				if(nx == cx && ny == cy) continue;
+				near[0][n] = shift[nx * ycrosses + ny][0];
+				near[1][n] = shift[nx * ycrosses + ny][1];
+				n++;
+			}
+		}
+		if(!n) continue;
+		qsort(near[0], n, sizeof(double), compare_doubles);
+		qsort(near[1], n, sizeof(double), compare_doubles);
+		double mx = near[0][n / 2], my = near[1][n / 2];
+		if(hypot(shift[i][0] - mx, shift[i][1] - my) <= limit) continue;
+
+		/* From the prediction, moved like the neighbours */
+		double *cross = decoder->crosses[i];
+		cross[0] += mx - shift[i][0];
+		cross[1] += my - shift[i][1];
+		image[strays][0] = cross[0];
+		image[strays][1] = cross[1];
+		list[strays++] = i;
+	}
+	sync_run(decoder, list, strays, 0);
+
+	/* The ones which still don't agree sit on dirt, the neighbours know
+	 * better */
+	unsigned int placed = 0;
+	for(unsigned int k = 0; k < strays; k++) {
+		double *cross = decoder->crosses[list[k]];
+
+		if(hypot(cross[0] - image[k][0], cross[1] - image[k][1]) <= limit) continue;
+		cross[0] = image[k][0];
+		cross[1] = image[k][1];
+		placed++;
+	}
+	fprintf(stderr, "Resynced %u stray crosses from their neighbours, %u placed by them.\n", strays, placed);
+
+	for(unsigned int i = 0; i < total; i++) list[i] = i;
+	sync_run(decoder, list, total, 1);
+
+	free(list);
+	free(page);
+	free(image);
+	free(shift);
+}
+
+/* Seeds the crosses from the last page and resyncs them over half the
+ * radius: pages fed through the same scanner land nearly alike. How the page
+ * moved since comes from the anchor crosses, moved like the corners and
+ * searched over the full radius. A cross found at the edge of the half may be
+ * further out and is searched over the full one too. Returns 0 with the
+ * crosses to be found from scratch if there's no last page, or if the
+ * anchors or more than one in WARM_MISSES crosses don't follow the last page:
+ * this one moved some other way. */
+static int sync_crosses_warm(struct OptarDecoder *decoder) {
+	unsigned int xcrosses = decoder->constants.format->xcrosses;
+	unsigned int ycrosses = decoder->constants.format->ycrosses;
+	unsigned int total = xcrosses * ycrosses;
+	int radius = decoder->chalf / 2;
+
+	if(!decoder->warm_crosses || !radius) return 0;
+
+	/* Half a bit off from the fit is too much */
+	double limit = MAX(decoder->hpixel, decoder->vpixel) / 2;
+	double h[8];
+	unsigned int *list = malloc(total * sizeof(*list));
+	double (*seeds)[2] = malloc(total * sizeof(*seeds));
+	if(!list || !seeds) {
+		fprintf(stderr, "Cannot allocate the cross seeds\n");
+		exit(1);
+	}
+
+	unsigned int anchors = list_anchors(decoder, list);
+	for(unsigned int i = 0; i < anchors; i++) {
+		unsigned int cx = list[i] / ycrosses, cy = list[i] % ycrosses;
+		double *cross = decoder->crosses[list[i]];
+		double u = CROSS_U(decoder, cx) / decoder->constants.width;
+		double v = CROSS_V(decoder, cy) / decoder->constants.height;
+
+		for(int k = 0; k < 2; k++) {
+			double moved[4];
+			for(int c = 0; c < 4; c++) moved[c] = (double)decoder->corners[c][k] - decoder->warm_corners[c][k];
+			cross[k] = decoder->warm_crosses[list[i]][k] + bilinear(moved[0], moved[1], moved[2], moved[3], u, v);
+		}
+	}
+	sync_run(decoder, list, anchors, 0);
+	unsigned int fitted = fit_crosses(decoder, h, list, anchors, decoder->warm_crosses, limit);
+	if(fitted < anchors - anchors / WARM_MISSES) {
+		fprintf(stderr, "Page moved since the last one, %u of %u anchor crosses follow it, searching from scratch.\n", fitted, anchors);
+		free(list);
+		free(seeds);
+		return 0;
+	}
+
+	for(unsigned int i = 0; i < total; i++) {
+		double *cross = decoder->crosses[i];
+
+		project(decoder, h, decoder->warm_crosses[i][0], decoder->warm_crosses[i][1], cross, cross + 1);
+		seeds[i][0] = cross[0];
+		seeds[i][1] = cross[1];
+		list[i] = i;
+	}
+	decoder->search_radius = radius;
+	sync_run(decoder, list, total, 0);
+	decoder->search_radius = decoder->chalf;
+
+	/* How far along the pixel vectors each one went */
+	double det = decoder->pixelhx * decoder->pixelvy - decoder->pixelvx * decoder->pixelhy;
+	unsigned int misses = 0;
+	for(unsigned int i = 0; i < total; i++) {
+		double *cross = decoder->crosses[i];
+		double dx = cross[0] - seeds[i][0], dy = cross[1] - seeds[i][1];
+		double dh = (dx * decoder->pixelvy - dy * decoder->pixelvx) / det;
+		double dv = (dy * decoder->pixelhx - dx * decoder->pixelhy) / det;
+
+		/* The peak fit moves at most half a pixel off the coarse step */
+		if(MAX(fabs(dh), fabs(dv)) <= radius - 0.25) continue;
+		cross[0] = seeds[i][0];
+		cross[1] = seeds[i][1];
+		list[misses++] = i;
+	}
+
+	int warm = misses <= total / WARM_MISSES;
+	if(warm) {
+		sync_run(decoder, list, misses, 0);
+		fprintf(stderr, "Crosses seeded from the last page, %u of %u searched over the full radius.\n", misses, total);
+
+		for(unsigned int i = 0; i < total; i++) list[i] = i;
+		sync_run(decoder, list, total, 1);
+	} else {
+		fprintf(stderr, "Page moved since the last one, %u of %u crosses off their seeds, searching from scratch.\n", misses, total);
+	}
+
+	free(list);
+	free(seeds);
+	return warm;
+}
+
+static void print_cutlevels(struct OptarDecoder *decoder) {
+	fprintf(stderr, "Cutlevels of the crosses (%u lines):\n", decoder->constants.format->ycrosses);
+	for(unsigned int cy = 0; cy < decoder->constants.format->ycrosses; cy++) {
+		fprintf(stderr, "%3u: ", cy);
+		for(unsigned int cx = 0; cx < decoder->constants.format->xcrosses; cx++) {
+			fprintf(stderr, "%02x ", (int)floor(decoder->cutlevels[CROSS(decoder, cx, cy)] + 0.5));
+		}
+		putc('\n', stderr);
+	}
+}
+
+/* Finds the crosses one after another, each from the one before it */
+static void sync_crosses_chain(struct OptarDecoder *decoder) {
 	/* Calculate the estimated cross pitch vectors */
-	double rightx = ((double)corners[1][0] + corners[3][0] - corners[0][0] - corners[2][0]) / 2 * unoptarconstants.format->cpitch / unoptarconstants.width;
-	double righty = ((double)corners[1][1] + corners[3][1] - corners[0][1] - corners[2][1]) / 2 * unoptarconstants.format->cpitch / unoptarconstants.width;
-	double downx =  ((double)corners[2][0] + corners[3][0] - corners[0][0] - corners[1][0]) / 2 * unoptarconstants.format->cpitch / unoptarconstants.height;
-	double downy =  ((double)corners[2][1] + corners[3][1] - corners[0][1] - corners[1][1]) / 2 * unoptarconstants.format->cpitch / unoptarconstants.height;
+	double rightx = ((double)decoder->corners[1][0] + decoder->corners[3][0] - decoder->corners[0][0] - decoder->corners[2][0]) / 2 * decoder->constants.format->cpitch / decoder->constants.width;
+	double righty = ((double)decoder->corners[1][1] + decoder->corners[3][1] - decoder->corners[0][1] - decoder->corners[2][1]) / 2 * decoder->constants.format->cpitch / decoder->constants.width;
+	double downx =  ((double)decoder->corners[2][0] + decoder->corners[3][0] - decoder->corners[0][0] - decoder->corners[1][0]) / 2 * decoder->constants.format->cpitch / decoder->constants.height;
+	double downy =  ((double)decoder->corners[2][1] + decoder->corners[3][1] - decoder->corners[0][1] - decoder->corners[1][1]) / 2 * decoder->constants.format->cpitch / decoder->constants.height;
 
 	/* Load the upper left cross with an estimate of it's position */
-	crosses[0][0][0] = bilinear(
-		corners[0][0], corners[1][0],
-		corners[2][0], corners[3][0],
-		(double)(unoptarconstants.format->border + unoptarconstants.format->chalf) / unoptarconstants.width,
-		(double)(unoptarconstants.format->border + unoptarconstants.format->chalf) / unoptarconstants.height
+	decoder->crosses[CROSS(decoder, 0, 0)][0] = bilinear(
+		decoder->corners[0][0], decoder->corners[1][0],
+		decoder->corners[2][0], decoder->corners[3][0],
+		(double)(decoder->constants.format->border + decoder->constants.format->chalf) / decoder->constants.width,
+		(double)(decoder->constants.format->border + decoder->constants.format->chalf) / decoder->constants.height
 	);
-	crosses[0][0][1] = bilinear(
-		corners[0][1], corners[1][1],
-		corners[2][1], corners[3][1],
-		(double)(unoptarconstants.format->border + unoptarconstants.format->chalf) / unoptarconstants.width,
-		(double)(unoptarconstants.format->border + unoptarconstants.format->chalf) / unoptarconstants.height
+	decoder->crosses[CROSS(decoder, 0, 0)][1] = bilinear(
+		decoder->corners[0][1], decoder->corners[1][1],
+		decoder->corners[2][1], decoder->corners[3][1],
+		(double)(decoder->constants.format->border + decoder->constants.format->chalf) / decoder->constants.width,
+		(double)(decoder->constants.format->border + decoder->constants.format->chalf) / decoder->constants.height
 	);
 
 	fprintf(stderr,"Finding crosses (%u lines), numbers indicate "
-			"individual cutlevels:\n", unoptarconstants.format->ycrosses);
+			"individual cutlevels:\n", decoder->constants.format->ycrosses);
 
 	// cross number
-	for (unsigned int cy = 0; cy < unoptarconstants.format->ycrosses; cy++) {
+	for (unsigned int cy = 0; cy < decoder->constants.format->ycrosses; cy++) {
 		fprintf(stderr, "%3u: ", cy);
-		for(unsigned int cx = 0; cx < unoptarconstants.format->xcrosses; cx++) {
+		for(unsigned int cx = 0; cx < decoder->constants.format->xcrosses; cx++) {
 			if(cx > 0) {
 				/* Copy from left */
-				crosses[cx][cy][0] = crosses[cx - 1][cy][0] + rightx;
-				crosses[cx][cy][1] = crosses[cx - 1][cy][1] + righty;
+				decoder->crosses[CROSS(decoder, cx, cy)][0] = decoder->crosses[CROSS(decoder, cx - 1, cy)][0] + rightx;
+				decoder->crosses[CROSS(decoder, cx, cy)][1] = decoder->crosses[CROSS(decoder, cx - 1, cy)][1] + righty;
 			} else if(cy > 0) {
 				/* Copy from above */
-				crosses[cx][cy][0] = crosses[cx][cy - 1][0] + downx;
-				crosses[cx][cy][1] = crosses[cx][cy - 1][1] + downy;
+				decoder->crosses[CROSS(decoder, cx, cy)][0] = decoder->crosses[CROSS(decoder, cx, cy - 1)][0] + downx;
+				decoder->crosses[CROSS(decoder, cx, cy)][1] = decoder->crosses[CROSS(decoder, cx, cy - 1)][1] + downy;
 			}/* else already preloaded */
-			resync_cross(crosses[cx][cy]);
-			cross_stats(cx, cy);
+			resync_cross(decoder, decoder->search_area, decoder->crosses[CROSS(decoder, cx, cy)]);
+			cross_stats(decoder, cx, cy);
+			fprintf(stderr, "%02x ", (int)floor(decoder->cutlevels[CROSS(decoder, cx, cy)] + 0.5));
 		}
 
 		putc('\n', stderr);
 	}
 }
 
+static void sync_crosses(struct OptarDecoder *decoder) {
+	if(decoder->warm_start && sync_crosses_warm(decoder)) {
+		print_cutlevels(decoder);
+	} else if(decoder->sync_jobs) {
+		sync_crosses_model(decoder);
+		print_cutlevels(decoder);
+	} else {
+		sync_crosses_chain(decoder);
+	}
+
+	if(decoder->warm_start) {
+		/* For the next page */
+		size_t bytes = decoder->constants.format->xcrosses * decoder->constants.format->ycrosses * sizeof(*decoder->crosses);
+
+		if(!decoder->warm_crosses) {
+			decoder->warm_crosses = malloc(bytes);
+			if(!decoder->warm_crosses) {
+				fprintf(stderr, "Cannot allocate the cross seeds\n");
+				exit(1);
+			}
+		}
+		memcpy(decoder->warm_crosses, decoder->crosses, bytes);
+		memcpy(decoder->warm_corners, decoder->corners, sizeof(decoder->corners));
+	}
+}
+
 /* x,y coords in bit matrix. 0,0 is in the upper left cross UL corner.
  * Returns pixel position with integers in centers of pixels. Interpolates
  * also the cutlevel */
-static void bit_coord(double *xout, double *yout, float *cutlevel, int x, int y) {
+static void bit_coord(struct OptarDecoder *decoder, double *xout, double *yout, float *cutlevel, int x, int y) {
 	/* First find the cross numbers */
 	/* Division of negative numbers is probably undefined in C! */
 	unsigned int cx, cy; /* Cross number */
-	if(x < unoptarconstants.format->chalf) cx = 0;
-	else cx = (x - unoptarconstants.format->chalf) / unoptarconstants.format->cpitch;
-	if(y < unoptarconstants.format->chalf) cy = 0;
-	else cy = (y - unoptarconstants.format->chalf) / unoptarconstants.format->cpitch;
-	if(cx > unoptarconstants.format->xcrosses - 2) cx = unoptarconstants.format->xcrosses - 2;
-	if(cy > unoptarconstants.format->ycrosses - 2) cy = unoptarconstants.format->ycrosses - 2;
+	if(x < decoder->constants.format->chalf) cx = 0;
+	else cx = (x - decoder->constants.format->chalf) / decoder->constants.format->cpitch;
+	if(y < decoder->constants.format->chalf) cy = 0;
+	else cy = (y - decoder->constants.format->chalf) / decoder->constants.format->cpitch;
+	if(cx > decoder->constants.format->xcrosses - 2) cx = decoder->constants.format->xcrosses - 2;
+	if(cy > decoder->constants.format->ycrosses - 2) cy = decoder->constants.format->ycrosses - 2;
 
 	/* Now subtrack cross coordinate */
-	x -= cx * unoptarconstants.format->cpitch + unoptarconstants.format->chalf;
-	y -= cy * unoptarconstants.format->cpitch + unoptarconstants.format->chalf;
-	/* x,y now the remainders. Can be negative or more than unoptarconstants.format->cpitch! */
+	x -= cx * decoder->constants.format->cpitch + decoder->constants.format->chalf;
+	y -= cy * decoder->constants.format->cpitch + decoder->constants.format->chalf;
+	/* x,y now the remainders. Can be negative or more than constants.format->cpitch! */
 
 	/* Calculate double precision remainders about from 0 to 1 (not always) */
-	double xrem = ((double)x + 0.5) / unoptarconstants.format->cpitch;
-	double yrem = ((double)y + 0.5) / unoptarconstants.format->cpitch;
+	double xrem = ((double)x + 0.5) / decoder->constants.format->cpitch;
+	double yrem = ((double)y + 0.5) / decoder->constants.format->cpitch;
 
 	double xd = bilinear(
-		crosses[cx][cy][0],     crosses[cx + 1][cy][0],
-		crosses[cx][cy + 1][0], crosses[cx + 1][cy + 1][0],
+		decoder->crosses[CROSS(decoder, cx, cy)][0],     decoder->crosses[CROSS(decoder, cx + 1, cy)][0],
+		decoder->crosses[CROSS(decoder, cx, cy + 1)][0], decoder->crosses[CROSS(decoder, cx + 1, cy + 1)][0],
 		xrem, yrem
 	);
 	double yd = bilinear(
-		crosses[cx][cy][1],     crosses[cx + 1][cy][1],
-		crosses[cx][cy + 1][1], crosses[cx + 1][cy + 1][1],
+		decoder->crosses[CROSS(decoder, cx, cy)][1],     decoder->crosses[CROSS(decoder, cx + 1, cy)][1],
+		decoder->crosses[CROSS(decoder, cx, cy + 1)][1], decoder->crosses[CROSS(decoder, cx + 1, cy + 1)][1],
 		xrem, yrem
 	);
 
 	if(cutlevel) {
 		*cutlevel = bilinearf(
-			cutlevels[cx][cy],     cutlevels[cx + 1][cy],
-			cutlevels[cx][cy + 1], cutlevels[cx + 1][cy + 1],
+			decoder->cutlevels[CROSS(decoder, cx, cy)],     decoder->cutlevels[CROSS(decoder, cx + 1, cy)],
+			decoder->cutlevels[CROSS(decoder, cx, cy + 1)], decoder->cutlevels[CROSS(decoder, cx + 1, cy + 1)],
 			xrem, yrem
 		);
 	}
@@ -797,39 +1257,143 @@ static void bit_coord(double *xout, double *yout, float *cutlevel, int x, int y)
 	*yout = yd;
 }
 
-static void read_payload_bit(unsigned char bit) {
-	static unsigned accu = 1;
+/* Hands decoded bytes to the sink, or writes them into output_stream */
+static void emit(struct OptarDecoder *decoder, const void *data, size_t len) {
+	if(decoder->sink) decoder->sink(decoder->sink_opaque, data, len);
+	else fwrite(data, 1, len, decoder->output_stream);
+}
+
+/* (Re)allocates what depends on the FEC of the format */
+static void alloc_symbols(struct OptarDecoder *decoder) {
+	unsigned long fec_syms = decoder->constants.fec_syms;
+
+	decoder->hamming = decoder->format.fec_order == 1 ? NULL : hamming_kernel(decoder->format.fec_order);
+	decoder->payload = realloc(decoder->payload, (decoder->constants.netbits + 7) >> 3);
+	decoder->words = realloc(decoder->words, sizeof(*decoder->words) * fec_syms);
+	decoder->data = realloc(decoder->data, sizeof(*decoder->data) * fec_syms);
+	decoder->syndromes = realloc(decoder->syndromes, fec_syms);
+	if(!(decoder->payload && decoder->words && decoder->data && decoder->syndromes)) {
+		fprintf(stderr, "Failed to allocate payload\n");
+		exit(1);
+	}
+}
+
+/* Switches to another format of the same geometry */
+static void set_format(struct OptarDecoder *decoder, struct PageFormat *format) {
+	decoder->format = *format;
+	compute_constants(&decoder->constants, &decoder->format);
+	alloc_symbols(decoder);
+}
+
+/* Takes the payload of a page with the given header (page 0 if it was
+ * unreadable) and writes it out in page order. A page which comes too early
+ * is copied aside until the ones before it are written. */
+static void write_payload(struct OptarDecoder *decoder, struct PageHeader *header, unsigned char *payload) {
+	unsigned int page = header->page;
+	unsigned long bytes = header->bytes;
+
+	if(page) {
+		if(header->pages) decoder->pages = header->pages;
+		if(header->length != OPTAR_UNKNOWN_LENGTH) decoder->length = header->length;
+		/* Decoded on another thread which took over the header's format */
+		if(memcmp(&header->format, &decoder->format, sizeof(decoder->format))) set_format(decoder, &header->format);
+	} else {
+		/* Take it for the one after the last page written, and full
+		 * unless the totals say otherwise */
+		page = decoder->next_page + decoder->n_pending;
+		bytes = decoder->constants.page_bytes;
+		if(page == decoder->pages && decoder->length != OPTAR_UNKNOWN_LENGTH) {
+			bytes = MIN(bytes, decoder->length - (unsigned long long)(page - 1) * bytes);
+		}
+		fprintf(stderr, "Taking it for page %u.\n", page);
+	}
+
+	if(page < decoder->next_page || (page < decoder->next_page + decoder->n_pending
+		&& decoder->pending[page - decoder->next_page].payload)) {
+		fprintf(stderr, "unoptar: page %u came twice, leaving it out\n", page);
+		return;
+	}
+
+	if(page > decoder->next_page) {
+		/* Too early. pending[0] stays empty for next_page. */
+		unsigned int index = page - decoder->next_page;
+		if(index >= decoder->n_pending) {
+			decoder->pending = realloc(decoder->pending, sizeof(*decoder->pending) * (index + 1));
+			if(!decoder->pending) {
+				fprintf(stderr, "Failed to allocate pending pages\n");
+				exit(1);
+			}
+			memset(decoder->pending + decoder->n_pending, 0, sizeof(*decoder->pending) * (index + 1 - decoder->n_pending));
+			decoder->n_pending = index + 1;
+		}
+		decoder->pending[index].payload = malloc(bytes ? bytes : 1);
+		if(!decoder->pending[index].payload) {
+			fprintf(stderr, "Failed to allocate pending page\n");
+			exit(1);
+		}
+		memcpy(decoder->pending[index].payload, payload, bytes);
+		decoder->pending[index].bytes = bytes;
+		return;
+	}
+
+	emit(decoder, payload, bytes);
+	decoder->written += bytes;
+	decoder->next_page++;
 
-	accu <<= 1;
-	accu |= bit & 1;
-	if(accu & (1 << 8)){
-		putchar(accu & 0xff);
-		accu = 1;
+	/* Then the pages which were waiting for it */
+	if(decoder->n_pending) {
+		memmove(decoder->pending, decoder->pending + 1, sizeof(*decoder->pending) * --decoder->n_pending);
+	}
+	while(decoder->n_pending && decoder->pending[0].payload) {
+		emit(decoder, decoder->pending[0].payload, decoder->pending[0].bytes);
+		decoder->written += decoder->pending[0].bytes;
+		decoder->next_page++;
+		free(decoder->pending[0].payload);
+		memmove(decoder->pending, decoder->pending + 1, sizeof(*decoder->pending) * --decoder->n_pending);
 	}
 }
 
-/* Cuts out given bit and shifts the upper part */
-static unsigned long shrink(unsigned long in, unsigned bitpos) {
-	unsigned long high;
-	in &= ~(1 << bitpos); /* Zero out the bit */
-	high = in;
-	in &= (1UL << bitpos) - 1;
-	high ^= in;
-	return (high >> 1) | in;
+/* Complains about the pages which never came, which makes the output
+ * damaged too */
+static void check_complete(struct OptarDecoder *decoder) {
+	unsigned int last = decoder->next_page - 1 + decoder->n_pending;
+	if(decoder->pages > last) last = decoder->pages;
+
+	for(unsigned int page = decoder->next_page; page <= last; page++) {
+		unsigned int index = page - decoder->next_page;
+		if(index >= decoder->n_pending || !decoder->pending[index].payload) {
+			fprintf(stderr, "unoptar: page %u is missing\n", page);
+			decoder->damaged = 1;
+		}
+	}
+	if(decoder->n_pending) {
+		fprintf(stderr, "unoptar: the pages after the first missing one weren't written\n");
+		decoder->damaged = 1;
+	}
+	if(decoder->length != OPTAR_UNKNOWN_LENGTH && decoder->written != decoder->length) {
+		fprintf(stderr, "unoptar: wrote %llu bytes of %llu\n", decoder->written, decoder->length);
+		decoder->damaged = 1;
+	}
+	decoder->finished = 1;
+
+	for(unsigned int index = 0; index < decoder->n_pending; index++) free(decoder->pending[index].payload);
+	free(decoder->pending);
+	decoder->pending = NULL;
+	decoder->n_pending = 0;
 }
 
-static void mark_bad_bit(unsigned int x, unsigned int y, int dir) {
+static void mark_bad_bit(struct OptarDecoder *decoder, unsigned int x, unsigned int y, int dir) {
 	if(dir) {
 		/* To 1, means black dirt. Upper left edge. */
-		for(unsigned int u = 0; u < leftedge; u++) writepixu(u, y, 0);
-		for(unsigned int u = 0; u < topedge; u++) writepixu(x, u, 0);
+		for(unsigned int u = 0; u < decoder->leftedge; u++) writepixu(u, y, 0);
+		for(unsigned int u = 0; u < decoder->topedge; u++) writepixu(x, u, 0);
 	} else {
 		/* To 0, means white dirt. Lower right edge. */
-		for(unsigned int u = rightedge; u < width; u++) writepixu(u, y, 0);
-		for(unsigned int u = bottomedge; u < height; u++) writepixu(x, u, 0);
+		for(unsigned int u = decoder->rightedge; u < decoder->width; u++) writepixu(u, y, 0);
+		for(unsigned int u = decoder->bottomedge; u < decoder->height; u++) writepixu(x, u, 0);
 	}
 
-	int size = floor(2 * sqrt(hpixel * vpixel) + 0.5);
+	int size = floor(2 * sqrt(decoder->hpixel * decoder->vpixel) + 0.5);
 	int v = dir ? 0 : 255;
 
 	for(int i = -size; i <= size; i++) {
@@ -849,15 +1413,15 @@ static void mark_bad_bit(unsigned int x, unsigned int y, int dir) {
 }
 
 /* Bit 0 is the one which comes at the top of the page, although it's stored in
- * bit unoptarconstants.fec_largebits-1 in the Hamming register.
+ * bit constants.fec_largebits-1 in the Hamming register.
  *
  * 1 dir means flipped from 0 to 1 (black dirt), 0 dir means flipped
  * from 1 to 0 (white dirt ), 2 dir means unknown
  *
  * Increments bad_01 or bad_10 and bad_total only for reparable errors.
  * Leaves bad_irreparable alone. */
-static void print_badbit(unsigned int symbol, unsigned int bit, unsigned int dir) {
-	if(!(bad_total)) {
+static void print_badbit(struct OptarDecoder *decoder, unsigned int symbol, unsigned int bit, unsigned int dir) {
+	if(!(decoder->bad_total)) {
 		fprintf(stderr,"The following coordinates have damaged bits. "
 				"\",\" is black dirt, \"'\" white dirt, \":\""
 				"bit which is a part of an irreparable symbol. "
@@ -866,21 +1430,21 @@ static void print_badbit(unsigned int symbol, unsigned int bit, unsigned int dir
 	}
 
 	if(dir == 1) {
-		bad_01++;
-		bad_total++;
+		decoder->bad_01++;
+		decoder->bad_total++;
 	} else if(dir == 0) {
-		bad_10++;
-		bad_total++;
+		decoder->bad_10++;
+		decoder->bad_total++;
 	}
 
 	int x, y;
-	seq2xy(&unoptarconstants, &x, &y, symbol + bit + unoptarconstants.fec_syms);
+	seq2xy(&decoder->constants, &x, &y, decoder->constants.headerbits + symbol + bit * decoder->constants.fec_syms);
 
 	double xd, yd; // integers in centres
-	bit_coord(&xd, &yd, NULL, x, y);
+	bit_coord(decoder, &xd, &yd, NULL, x, y);
 	xd = floor(xd + 0.5);
 	yd = floor(yd + 0.5);
-	mark_bad_bit(xd, yd, dir);
+	mark_bad_bit(decoder, xd, yd, dir);
 	assert(x >= 0);
 
 	unsigned char delim;
@@ -893,21 +1457,21 @@ static void print_badbit(unsigned int symbol, unsigned int bit, unsigned int dir
 	fprintf(stderr, "%ld%c%ld ", (long)xd, delim, (long)yd);
 }
 
-static void print_badbit_finish(void) {
-	if(bad_total) {
+static void print_badbit_finish(struct OptarDecoder *decoder) {
+	if(decoder->bad_total) {
 		fprintf(stderr,"\n%lu bits bad from %llu, bit error rate %G%%. %G%% black dirt, %G%% white dirt and %lu (%G%%) irreparable.\n",
-			bad_total,
-			unoptarconstants.usedbits, 
-			100 * (double)(bad_total) / unoptarconstants.usedbits,
-			100 * (double)bad_01 / (bad_total),
-			100 * (double)bad_10 / (bad_total),
-			irreparable,
-			100 * (double)irreparable / (bad_total)
+			decoder->bad_total,
+			decoder->constants.usedbits, 
+			100 * (double)(decoder->bad_total) / decoder->constants.usedbits,
+			100 * (double)decoder->bad_01 / (decoder->bad_total),
+			100 * (double)decoder->bad_10 / (decoder->bad_total),
+			decoder->irreparable,
+			100 * (double)decoder->irreparable / (decoder->bad_total)
 		);
 	} else fprintf(stderr, "No bad bits!\n");
 
 
-	if(unoptarconstants.format->fec_order == 1) {
+	if(decoder->constants.format->fec_order == 1) {
 		fprintf(stderr,"Golay stats\n"
 			       "===========\n"
 			"0 bad bits      %lu\n"
@@ -916,357 +1480,558 @@ static void print_badbit_finish(void) {
 			"3 bad bits      %lu\n"
 			"4 bad bits      %lu\n"
 			"total codewords %lu\n",
-			golay_stats[0],
-			golay_stats[1],
-			golay_stats[2],
-			golay_stats[3],
-			golay_stats[4],
-			golay_stats[0] + golay_stats[1] + golay_stats[2] + golay_stats[3] + golay_stats[4]
+			decoder->golay_stats[0],
+			decoder->golay_stats[1],
+			decoder->golay_stats[2],
+			decoder->golay_stats[3],
+			decoder->golay_stats[4],
+			decoder->golay_stats[0] + decoder->golay_stats[1] + decoder->golay_stats[2] + decoder->golay_stats[3] + decoder->golay_stats[4]
 		);
 	}
 }
 
-void golay_bad_bits(unsigned long right, unsigned long wrong, unsigned long symno) {
+static void golay_bad_bits(struct OptarDecoder *decoder, unsigned long right, unsigned long wrong, unsigned long symno) {
 	/* 23 MSB, 0 LSB */
 	for(int bit=23; bit >= 0; bit--) {
 		if((right ^ wrong) & (1UL << bit)) {
 			/* Error at this place */
-			print_badbit(symno, 23 - bit, (wrong >> bit) & 1);
+			print_badbit(decoder, symno, 23 - bit, (wrong >> bit) & 1);
 		}
 	}
 }
 
-static unsigned long ungolay(unsigned long in, unsigned long symno) {
-	unsigned int data = in >> 12;
+static unsigned long ungolay(struct OptarDecoder *decoder, unsigned long in, unsigned long symno) {
+	unsigned long error = golay_syndromes[(golay(in >> 12) ^ in) & 0xfff];
 
-	if(golay(data) == in) {
-		golay_stats[0]++;
-		return data; /* No error */
+	if(!error) {
+		decoder->golay_stats[0]++;
+		return in >> 12; /* No error */
 	}
 
-	/* Search for a symbol that differs in max. 3 positions */
-	for(data = 0; data < (1 << 12); data++) {
-		unsigned int n_ones = ones(golay_codes[data] ^ in);
-		if(n_ones <= 3) {
-			/* Found the right answer */
-			golay_bad_bits(golay_codes[data], in, symno);
-			golay_stats[n_ones]++;
-			return data;
-		}
+	if(error != GOLAY_IRREPARABLE) {
+		/* Max. 3 flipped bits, the syndrome tells which */
+		golay_bad_bits(decoder, in ^ error, in, symno);
+		decoder->golay_stats[ones(error)]++;
+		return (in ^ error) >> 12;
 	}
 
-	/* "data" is not valid anymore now! */
-
 	/* Irreparable */
 	{
 		fputc('\n', stderr);
-		for(int badbit = 0; badbit < 24; badbit++) print_badbit(symno, badbit, 2);
+		for(int badbit = 0; badbit < 24; badbit++) print_badbit(decoder, symno, badbit, 2);
 		fprintf(stderr, "!\n");
-		irreparable += 4;
-		bad_total += 4;
-		golay_stats[4]++;
+		decoder->irreparable += 4;
+		decoder->bad_total += 4;
+		decoder->golay_stats[4]++;
 		return in >> 12; 
 	}
 
 }
 
-/* symno is just to figure out xy when printing broken bits. Only the
- * lowest unoptarconstants.fec_largebits are taken into account on input. */
-static unsigned long unhamming(unsigned long in, unsigned long symno) {
-	unsigned int bugpos=0;
+/* Reports what the Hamming kernel found wrong with the words of the page */
+static void hamming_bad_bits(struct OptarDecoder *decoder) {
+	unsigned int largebits = decoder->constants.fec_largebits;
 
-	/* Split the shift to make sure that it works even it unoptarconstants.fec_largebits
-	 * is the full size of the type */
-	in &= (1UL << (unoptarconstants.fec_largebits - 1) << 1) - 1;
-	
-	if(unoptarconstants.format->fec_order >= 5) {
-		bugpos |= parity(in & 0xffff0000) << 4;
-	}
-	if(unoptarconstants.format->fec_order >= 4) {
-		bugpos |= parity(in & 0xff00ff00) << 3;
-	}
-	if(unoptarconstants.format->fec_order >= 3) {
-		bugpos |= parity(in & 0xf0f0f0f0) << 2;
-	}
+	for(unsigned long symno = 0; symno < decoder->constants.fec_syms; symno++) {
+		unsigned int c = decoder->syndromes[symno];
+		if(!c) continue;
 
-	bugpos |= parity(in & 0xcccccccc) << 1;
-	bugpos |= parity(in & 0xaaaaaaaa);
-	if(bugpos) {
-		in ^= 1UL << bugpos;
-	}
-	if(parity(in)) {
-		/* Bad parity */
-		if(bugpos) {
+		if(c & 32) {
+			/* One flipped bit, at the syndrome. 0 is the parity bit. */
+			unsigned int bugpos = c & 31;
+			print_badbit(decoder, symno, largebits - 1 - bugpos, (decoder->words[symno] >> bugpos) & 1);
+		} else {
 			/* Irreparable */
 			fprintf(stderr, "\n");
-			for(unsigned int bit = 0; bit < unoptarconstants.fec_largebits; bit++) print_badbit(symno, bit, 2);
-			irreparable += 2;
-			bad_total += 2;
+			for(unsigned int bit = 0; bit < largebits; bit++) print_badbit(decoder, symno, bit, 2);
+			decoder->irreparable += 2;
+			decoder->bad_total += 2;
 			fprintf(stderr, "!\n"); /* Cannot correct */
-		} else {
-			/* Just flipped parity */
-			print_badbit(symno, unoptarconstants.fec_largebits - 1, in & 1);
 		}
-	} else {
-		print_badbit(symno, unoptarconstants.fec_largebits - 1 - bugpos, ((~in) & 1UL << bugpos));
 	}
+}
 
-	if(unoptarconstants.format->fec_order >= 5) {
-		in = shrink(in, 16);
+/* Packs the decoded symbols, fec_smallbits each, MSB first into payload */
+static void pack_payload(struct OptarDecoder *decoder) {
+	unsigned int smallbits = decoder->constants.fec_smallbits;
+	unsigned char *out = decoder->payload;
+	unsigned long long accu = 0;
+	unsigned int accubits = 0;
+
+	for(unsigned long symno = 0; symno < decoder->constants.fec_syms; symno++) {
+		accu = accu << smallbits | decoder->data[symno];
+		accubits += smallbits;
+		while(accubits >= 8) {
+			accubits -= 8;
+			*out++ = accu >> accubits;
+		}
 	}
-	if(unoptarconstants.format->fec_order >= 4) {
-		in = shrink(in, 8);
+	if(accubits) *out = accu << (8 - accubits);
+}
+
+static void reset_stats(struct OptarDecoder *decoder) {
+	decoder->bad_01 = 0;
+	decoder->bad_10 = 0;
+	decoder->bad_total = 0;
+	decoder->irreparable = 0;
+	memset(decoder->golay_stats, 0, sizeof(decoder->golay_stats));
+}
+
+/* Expands ul, ur, ll, lr into the coefficients for bilinear() */
+static void cell_coefs(double *out, double ul, double ur, double ll, double lr) {
+	out[0] = ul;
+	out[1] = ur - ul;
+	out[2] = ll - ul;
+	out[3] = lr - ll - ur + ul;
+}
+
+static void cell_coefsf(float *out, float ul, float ur, float ll, float lr) {
+	out[0] = ul;
+	out[1] = ur - ul;
+	out[2] = ll - ul;
+	out[3] = lr - ll - ur + ul;
+}
+
+/* Precalculates the cells from crosses and cutlevels */
+static void make_cells(struct OptarDecoder *decoder) {
+	struct Cell *cell = decoder->cells;
+
+	for(unsigned int cy = 0; cy < decoder->constants.format->ycrosses - 1; cy++) {
+		for(unsigned int cx = 0; cx < decoder->constants.format->xcrosses - 1; cx++, cell++) {
+			cell_coefs(cell->x,
+				decoder->crosses[CROSS(decoder, cx, cy)][0],     decoder->crosses[CROSS(decoder, cx + 1, cy)][0],
+				decoder->crosses[CROSS(decoder, cx, cy + 1)][0], decoder->crosses[CROSS(decoder, cx + 1, cy + 1)][0]);
+			cell_coefs(cell->y,
+				decoder->crosses[CROSS(decoder, cx, cy)][1],     decoder->crosses[CROSS(decoder, cx + 1, cy)][1],
+				decoder->crosses[CROSS(decoder, cx, cy + 1)][1], decoder->crosses[CROSS(decoder, cx + 1, cy + 1)][1]);
+			cell_coefsf(cell->cutlevel,
+				decoder->cutlevels[CROSS(decoder, cx, cy)],     decoder->cutlevels[CROSS(decoder, cx + 1, cy)],
+				decoder->cutlevels[CROSS(decoder, cx, cy + 1)], decoder->cutlevels[CROSS(decoder, cx + 1, cy + 1)]);
+
+			/* Integers in UL corners -> integers in centers */
+			cell->x[0] -= 0.5;
+			cell->y[0] -= 0.5;
+		}
 	}
-	if(unoptarconstants.format->fec_order >= 3) {
-		in = shrink(in, 4);
+}
+
+/* Samples count channel bits on row y, starting at x (both like in seq2xy),
+ * which all lie in the given cell. cellx is x of the cell's left crosses,
+ * vpar the vertical position of the row inside the cell. Returns where it
+ * stopped writing. */
+static unsigned char *sample_run(struct OptarDecoder *decoder, unsigned char *out, struct Cell *cell, int cellx, double vpar, int x, int y, unsigned int count) {
+	double step = 1.0 / decoder->constants.format->cpitch;
+	double hpar = ((double)(x - cellx) + 0.5) * step;
+
+	/* Position and its increment per bit along the row */
+	double xcoord = cell->x[0] + cell->x[2] * vpar + (cell->x[1] + cell->x[3] * vpar) * hpar;
+	double ycoord = cell->y[0] + cell->y[2] * vpar + (cell->y[1] + cell->y[3] * vpar) * hpar;
+	float local_cutlevel = cell->cutlevel[0] + cell->cutlevel[2] * vpar + (cell->cutlevel[1] + cell->cutlevel[3] * vpar) * hpar;
+	double xstep = (cell->x[1] + cell->x[3] * vpar) * step;
+	double ystep = (cell->y[1] + cell->y[3] * vpar) * step;
+	float cutlevel_step = (cell->cutlevel[1] + cell->cutlevel[3] * vpar) * step;
+
+	for(; count; count--, x++) {
+		float pixval = pixel_correct_sample(decoder, xcoord, ycoord);
+
+		/* Possibly make a mark */
+		if(!(x & 7) || !(y & 7)) {
+			int writeval = floor(pixval + 0.5);
+			if(writeval > 255) writeval = 255;
+			else if(writeval < 0) writeval = 0;
+			writeval ^= 255;
+
+			/* Make a debug dot */
+			writepix(xcoord + 0.5, ycoord + 0.5, writeval);
+		}
+
+		*out++ = pixval < local_cutlevel;
+
+		xcoord += xstep;
+		ycoord += ystep;
+		local_cutlevel += cutlevel_step;
 	}
 
-	in >>= 3;
-	return in;
+	return out;
 }
 
-static void read_hamming_bit(unsigned char input, unsigned long symno) {
-	static unsigned int accubits;
-	static unsigned long accu;
+/* Fills channel_bits walking the runs of the page layout, which are in raster
+ * order and also in the order of channel sequence numbers. */
+static void sample_channel(struct OptarDecoder *decoder) {
+	unsigned int cpitch = decoder->constants.format->cpitch;
+	unsigned int cross_half = decoder->constants.format->chalf;
+	unsigned int cells_across = decoder->constants.format->xcrosses - 1;
+	const struct LayoutRun *run = decoder->layout->runs;
+	const struct LayoutRun *end = run + decoder->layout->n_runs;
+	unsigned char *out = decoder->channel_bits;
+
+	for(; run < end; run++) {
+		double vpar = ((double)run->y - run->cy * cpitch - cross_half + 0.5) / cpitch;
 
-	accu <<= 1;
-	accu |= input & 1;
-	accubits++;
-	if(accubits >= unoptarconstants.fec_largebits) {
-		if(unoptarconstants.format->fec_order == 1) {
-			accu = ungolay(accu, symno);
+		out = sample_run(decoder, out, decoder->cells + run->cy * cells_across + run->cx,
+			run->cx * cpitch + cross_half, vpar, run->x, run->y, run->length);
+	}
+
+	assert(out == decoder->channel_bits + decoder->constants.totalbits);
+}
+
+/* Reads the page header from either of its copies in channel_bits. A
+ * different fec_order in it is taken over, since it doesn't move the channel
+ * bits. A different border or text_height does: they size the page the
+ * crosses were searched on, so the header is ignored and the page has to be
+ * decoded again with the right format. */
+static void read_header(struct OptarDecoder *decoder) {
+	struct PageHeader *header = &decoder->header;
+	struct PageFormat *format = &header->format;
+
+	if(!header_decode(header, decoder->channel_bits)
+		&& !header_decode(header, decoder->channel_bits + decoder->constants.totalbits - decoder->constants.headerbits)) {
+		fprintf(stderr, "The page header is damaged beyond repair.\n");
+		header->page = 0;
+		decoder->damaged = 1;
+		return;
+	}
+
+	if(header->pages) fprintf(stderr, "Page %u of %u", header->page, header->pages);
+	else fprintf(stderr, "Page %u", header->page);
+	fprintf(stderr, ", %lu bytes.\n", header->bytes);
+
+	if(memcmp(format, &decoder->format, sizeof(*format))) {
+		fprintf(stderr, "The page is 0-%u-%u-%u-%u-%u-%u-%u rather than 0-%u-%u-%u-%u-%u-%u-%u, ",
+			format->xcrosses, format->ycrosses, format->cpitch, format->chalf,
+			format->fec_order, format->border, format->text_height,
+			decoder->format.xcrosses, decoder->format.ycrosses, decoder->format.cpitch, decoder->format.chalf,
+			decoder->format.fec_order, decoder->format.border, decoder->format.text_height);
+		if(format->xcrosses != decoder->format.xcrosses || format->ycrosses != decoder->format.ycrosses
+			|| format->cpitch != decoder->format.cpitch || format->chalf != decoder->format.chalf) {
+			fprintf(stderr, "but the crosses don't match, ignoring the header.\n");
+			header->page = 0;
+			decoder->damaged = 1;
+		} else if(format->border != decoder->format.border || format->text_height != decoder->format.text_height) {
+			fprintf(stderr, "but the border and text height place the crosses, ignoring the header. Decode again with that format.\n");
+			header->page = 0;
+			decoder->damaged = 1;
 		} else {
-			accu = unhamming(accu, symno);
+			fprintf(stderr, "using that.\n");
+			set_format(decoder, format);
 		}
+	}
+	if(header->bytes > decoder->constants.page_bytes) header->bytes = decoder->constants.page_bytes;
+}
 
-		for(int shift = unoptarconstants.fec_smallbits - 1; shift >= 0; shift--) read_payload_bit(accu >> shift);
-		accu = 0;
-		accubits = 0;
-	}
-}
-
-void reset_stats(void) {
-	bad_01 = 0;
-	bad_10 = 0;
-	bad_total = 0;
-	irreparable = 0;
-	memset(golay_stats, 0, sizeof(golay_stats));
-}
-
-static void read_syms(void) {
-	reset_stats();
-
-	/* Hamming symbol sequence number */
-	unsigned int bit;
-	unsigned long seq;
-	double xcoord, ycoord; /* Integers in centers */
-	float pixval;
-	float local_cutlevel;
-	int x, y; /* 0,0 is upper left pixel of upper left cross */
-	for(unsigned long hamming_sym = 0; hamming_sym < unoptarconstants.fec_syms; hamming_sym++) {
-		for(bit = 0; bit < unoptarconstants.fec_largebits; bit++) {
-			/* Bit here will correspond to bit unoptarconstants.fec_smallbits-1
-			 * in the Hamming register. */
-			seq = hamming_sym + bit * unoptarconstants.fec_syms;
-			seq2xy(&unoptarconstants, &x, &y, seq);
-			bit_coord(&xcoord, &ycoord, &local_cutlevel, x, y);
-			pixval = pixel_correct_sample(xcoord, ycoord);
-
-			/* Possibly make a mark */
-			if(!(x & 7) || !(y & 7)) {
-				int writeval = floor(pixval + 0.5);
-				if(writeval > 255) writeval = 255;
-				else if(writeval < 0) writeval = 0;
-				writeval ^= 255;
-
-				/* Make a debug dot */
-				writepix(xcoord + 0.5, ycoord + 0.5, writeval);
-			}
+static void read_syms(struct OptarDecoder *decoder) {
+	reset_stats(decoder);
 
-			read_hamming_bit(pixval < local_cutlevel, hamming_sym);
-		}
+	make_cells(decoder);
+	sample_channel(decoder);
+	read_header(decoder);
+
+	/* Gather the codewords, bit k of all of them is one contiguous plane
+	 * of the channel */
+	unsigned long fec_syms = decoder->constants.fec_syms;
+	unsigned long *words = decoder->words;
+	memset(words, 0, sizeof(*words) * fec_syms);
+	for(unsigned int k = 0; k < decoder->constants.fec_largebits; k++) {
+		const unsigned char *plane = decoder->channel_bits + decoder->constants.headerbits + k * fec_syms;
+		unsigned int shift = decoder->constants.fec_largebits - 1 - k;
+
+		for(unsigned long symno = 0; symno < fec_syms; symno++) words[symno] |= (unsigned long)plane[symno] << shift;
 	}
 
-	print_badbit_finish();
+	if(decoder->hamming) {
+		decoder->hamming->decode(words, decoder->data, decoder->syndromes, fec_syms);
+		hamming_bad_bits(decoder);
+	} else {
+		for(unsigned long symno = 0; symno < fec_syms; symno++) decoder->data[symno] = ungolay(decoder, words[symno], symno);
+	}
+	pack_payload(decoder);
+
+	print_badbit_finish(decoder);
+
+	/* The page checks itself */
+	if(decoder->header.page) {
+		if(crc32(0, decoder->payload, decoder->header.bytes) == decoder->header.crc) fprintf(stderr, "Page %u is intact.\n", decoder->header.page);
+		else {
+			fprintf(stderr, "unoptar: page %u is damaged, its CRC doesn't match\n", decoder->header.page);
+			decoder->damaged = 1;
+		}
+	}
 }
 
 /* Doesn't depend on width and height. */
-static void print_chan_info(void) {
-	fprintf(stderr, "Unformatted channel capacity %G kB, ",                      (double)unoptarconstants.width * unoptarconstants.height / 8 / 1000);
-	fprintf(stderr, "formatted raw channel capacity %G kB, ",                    (double)unoptarconstants.totalbits / 8 / 1000);
-	fprintf(stderr, "net EC payload capacity %G kB, ",                           (double)unoptarconstants.netbits / 8 / 1000);
-	fprintf(stderr, "%llu EC symbols, ",                                         unoptarconstants.fec_syms);
-	fprintf(stderr, "%llu bits unused (incomplete Hamming symbol), ",            unoptarconstants.totalbits-unoptarconstants.usedbits);
-	fprintf(stderr, "border taking %G%% of unformatted capacity, ",              100 * (1 - (double)(unoptarconstants.data_width) * (unoptarconstants.data_height) / unoptarconstants.width / unoptarconstants.height));
-	fprintf(stderr, "border with crosses taking %G%% of unformatted capacity, ", 100 * (1 - (double)(unoptarconstants.totalbits) / unoptarconstants.width / unoptarconstants.height));
+static void print_chan_info(struct OptarDecoder *decoder) {
+	fprintf(stderr, "Unformatted channel capacity %G kB, ",                      (double)decoder->constants.width * decoder->constants.height / 8 / 1000);
+	fprintf(stderr, "formatted raw channel capacity %G kB, ",                    (double)decoder->constants.totalbits / 8 / 1000);
+	fprintf(stderr, "net EC payload capacity %G kB, ",                           (double)decoder->constants.netbits / 8 / 1000);
+	fprintf(stderr, "%llu EC symbols, ",                                         decoder->constants.fec_syms);
+	fprintf(stderr, "%llu bits of page headers, ",                               2 * decoder->constants.headerbits);
+	fprintf(stderr, "%llu bits unused (incomplete Hamming symbol), ",            decoder->constants.totalbits - 2 * decoder->constants.headerbits - decoder->constants.usedbits);
+	fprintf(stderr, "border taking %G%% of unformatted capacity, ",              100 * (1 - (double)(decoder->constants.data_width) * (decoder->constants.data_height) / decoder->constants.width / decoder->constants.height));
+	fprintf(stderr, "border with crosses taking %G%% of unformatted capacity, ", 100 * (1 - (double)(decoder->constants.totalbits) / decoder->constants.width / decoder->constants.height));
 	fprintf(stderr,"border with crosses and EC taking %G%% of "
-		"unformatted capacity.\n",                                               100 * (1 - (double)(unoptarconstants.netbits) / unoptarconstants.width / unoptarconstants.height));
+		"unformatted capacity.\n",                                               100 * (1 - (double)(decoder->constants.netbits) / decoder->constants.width / decoder->constants.height));
 }
 
-static void print_marks(void) {
+static void print_marks(struct OptarDecoder *decoder) {
 
-	mark(corners[0][0], corners[0][1]);
-	mark(corners[1][0], corners[1][1]);
-	mark(corners[2][0], corners[2][1]);
-	mark(corners[3][0], corners[3][1]);
+	mark(decoder, decoder->corners[0][0], decoder->corners[0][1]);
+	mark(decoder, decoder->corners[1][0], decoder->corners[1][1]);
+	mark(decoder, decoder->corners[2][0], decoder->corners[2][1]);
+	mark(decoder, decoder->corners[3][0], decoder->corners[3][1]);
 
 	// cross number
-	for(unsigned int cy = 0; cy < unoptarconstants.format->ycrosses; cy++) {
-		for(unsigned int cx = 0; cx < unoptarconstants.format->xcrosses; cx++) {
-			mark(crosses[cx][cy][0], crosses[cx][cy][1]);
-			mark(PSHIFTX(crosses[cx][cy][0], chalf,  0),      PSHIFTY(crosses[cx][cy][1], chalf,  0));
-			mark(PSHIFTX(crosses[cx][cy][0], -chalf, 0),      PSHIFTY(crosses[cx][cy][1], -chalf, 0));
-			mark(PSHIFTX(crosses[cx][cy][0], 0,      chalf),  PSHIFTY(crosses[cx][cy][1], 0,      chalf));
-			mark(PSHIFTX(crosses[cx][cy][0], 0,      -chalf), PSHIFTY(crosses[cx][cy][1], 0,      -chalf));
+	for(unsigned int cy = 0; cy < decoder->constants.format->ycrosses; cy++) {
+		for(unsigned int cx = 0; cx < decoder->constants.format->xcrosses; cx++) {
+			double *cross = decoder->crosses[CROSS(decoder, cx, cy)];
+
+			mark(decoder, cross[0], cross[1]);
+			mark(decoder, PSHIFTX(cross[0], decoder->chalf,  0),      PSHIFTY(cross[1], decoder->chalf,  0));
+			mark(decoder, PSHIFTX(cross[0], -decoder->chalf, 0),      PSHIFTY(cross[1], -decoder->chalf, 0));
+			mark(decoder, PSHIFTX(cross[0], 0,      decoder->chalf),  PSHIFTY(cross[1], 0,      decoder->chalf));
+			mark(decoder, PSHIFTX(cross[0], 0,      -decoder->chalf), PSHIFTY(cross[1], 0,      -decoder->chalf));
 		}
 	}
 }
 
+/* The horizontal 1 2 1 of a row. The leftmost and rightmost pixels are
+ * never blurred, so they don't get one. */
+static void blur_hsum(unsigned short *hsum, const unsigned char *src, long width) {
+	for(long x = 1; x < width - 1; x++) hsum[x] = src[x - 1] + 2 * src[x] + src[x + 1];
+}
+
+/* The vertical 1 2 1 of the horizontal sums of three rows, rounded like
+ * the whole 3x3 kernel */
+static void blur_row(unsigned char *dest, const unsigned char *src, const unsigned short *above, const unsigned short *here, const unsigned short *below, long width) {
+	dest[0] = src[0]; /* Leftmost pixel */
+	for(long x = 1; x < width - 1; x++) {
+		dest[x] = (above[x] + 2 * here[x] + below[x] + 8) >> 4; /* 4+2+2+2+2+1+1+1+1=16 */
+	}
+	dest[width - 1] = src[width - 1]; /* Rightmost pixel */
+}
+
 /* Blurs ary into newary with the following kernel:
  * 1 2 1
  * 2 4 2
  * 1 2 1
- */
-static void blur_copy(void) {
+ * and leaves the result in both. The kernel is separable, so it runs as a
+ * horizontal and a vertical 1 2 1 over integer sums, which rounds exactly
+ * like the 3x3 one. All the cycles are done in one pass over the image:
+ * cycle c keeps its last three rows and their horizontal sums, and row y of
+ * cycle c is made as soon as row y + 1 of cycle c - 1 is there. */
+static void blur_copy(struct OptarDecoder *decoder) {
 	/* Round to nearest */
-	int blur_cycles = floor(vpixel * hpixel * pixel_blur * pixel_blur + 0.5);
-
-	if(blur_cycles) fprintf(stderr, "Doing %d cycles of 1 2 1 / 2 4 2 / 1 2 1 blur.\n" , blur_cycles);
-
-	for(int cycles = 1; cycles <= blur_cycles; cycles++) {
-		unsigned char *dest = newary;
-		unsigned char *src = ary;
-		memcpy(dest, src, width); /* Topmost row */
-		dest += width;
-		src += width;
-
-		for(long yctr = height - 2; yctr > 0; yctr--) {
-			*dest++ = *src++; /* Leftmost pixel */
-			for(long xctr = width - 2; xctr > 0; xctr--) {
-				int val = src[0] << 2;
-				val +=  (src[-1] + src[1] + *(src - width) + src[width]) << 1;
-				val += *(src - 1 - width) + *(src - width + 1) + src[width - 1] + src[width + 1];
-				val =   (val + 8) >> 4; /* 4+2+2+2+2+1+1+1+1=16 */
-				*dest++ = val;
-				src++;
+	int blur_cycles = floor(decoder->vpixel * decoder->hpixel * pixel_blur * pixel_blur + 0.5);
+	long width = decoder->width, height = decoder->height;
+
+	if(!blur_cycles) {
+		memcpy(decoder->newary, decoder->ary, width * height);
+		return;
+	}
+	fprintf(stderr, "Doing %d cycles of 1 2 1 / 2 4 2 / 1 2 1 blur.\n" , blur_cycles);
+
+	/* Rows of the input and the cycles but the last one, which goes
+	 * straight to newary */
+	unsigned char *rows = malloc(blur_cycles * 3 * width);
+	unsigned short *hsums = malloc(blur_cycles * 3 * width * sizeof(*hsums));
+	if(!rows || !hsums) {
+		fprintf(stderr, "Cannot allocate blur rows.\n");
+		exit(1);
+	}
+
+	for(long t = 0; t < height + blur_cycles; t++) {
+		for(int c = 0; c <= blur_cycles; c++) {
+			long y = t - c;
+			if(y < 0 || y >= height) continue;
+
+			unsigned char *dest = c == blur_cycles ? decoder->newary + y * width : rows + (c * 3 + y % 3) * width;
+			if(!c) {
+				memcpy(dest, decoder->ary + y * width, width);
+			} else {
+				const unsigned char *src = rows + ((c - 1) * 3 + y % 3) * width;
+				const unsigned short *hsum = hsums + (c - 1) * 3 * width;
+
+				if(!y || y == height - 1) memcpy(dest, src, width); /* Topmost and bottommost row */
+				else blur_row(dest, src, hsum + (y - 1) % 3 * width, hsum + y % 3 * width, hsum + (y + 1) % 3 * width, width);
 			}
-			*dest++ = *src++; /* Rightmost pixel */
+
+			/* ary is only read in cycle 0, which is past row y */
+			if(c == blur_cycles) memcpy(decoder->ary + y * width, dest, width);
+			else blur_hsum(hsums + (c * 3 + y % 3) * width, dest, width);
 		}
-		memcpy(dest, src, width); /* Bottommost row */
-		memcpy(ary, newary, width * height);
-		fprintf(stderr, "%d ", cycles);
 	}
-	if(!blur_cycles) memcpy(newary, ary, width * height);
-	else fprintf(stderr, "\n");
+
+	free(rows);
+	free(hsums);
 }
 
-/* Shifts half pixel right and down! */
-static void max(void) {
-	unsigned char *ptr = ary + (unsigned long)width * height;
-	unsigned char *linestart;
-	for(unsigned long yctr = height; yctr; yctr--) {
-		linestart = ptr - width;
-		ptr--;
-		for(; ptr > linestart; ptr--) ptr[0] = MAX(ptr[0], ptr[-1]);
+/* MAX for a dilation, MIN for an erosion */
+static inline unsigned char extreme(int dilate, unsigned char a, unsigned char b) {
+	return dilate ? MAX(a, b) : MIN(a, b);
+}
+
+/* Extreme of the pixel and the n before it along a line of count pixels,
+ * step apart, fewer at its start. The van Herk/Gil-Werman way: cut the line
+ * into blocks of n + 1, then the window is the extreme of the suffix of one
+ * block and the prefix of the next, whatever n is. suffix takes count
+ * pixels. */
+static void minmax_line(unsigned char *line, long step, long count, long n, int dilate, unsigned char *suffix) {
+	long k = n + 1;
+	unsigned char prefix = 0;
+
+	for(long i = count - 1; i >= 0; i--) {
+		unsigned char pixel = line[i * step];
+		suffix[i] = i % k == k - 1 || i == count - 1 ? pixel : extreme(dilate, suffix[i + 1], pixel);
 	}
+	for(long i = 0; i < count; i++) {
+		unsigned char *ptr = line + i * step;
 
-	unsigned char *end = ary + width;
-	for(ptr = ary + (unsigned long)width * height - 1; ptr >= end; ptr--) ptr[0] = MAX(ptr[0], *(ptr - width));
+		prefix = i % k ? extreme(dilate, prefix, *ptr) : *ptr;
+		*ptr = i < n ? prefix : extreme(dilate, suffix[i - n], prefix);
+	}
 }
 
-/* Shifts half pixel left and up! */
-static void min(void){
-	unsigned char *ptr, *end;
-	unsigned long yctr;
-
-	for(ptr = ary, yctr = height; yctr; yctr--) {
-		for(end = ptr + width - 1; ptr < end; ptr++) {
-			ptr[0] = MIN(ptr[0], ptr[1]);
+/* Extreme of every pixel and the n rows before it, fewer at the top, done
+ * like minmax_line with whole rows. The image goes by in bands of n + 1
+ * rows: the suffixes of a band and the one before it are kept in suffix,
+ * 2 * (n + 1) rows of width, and the prefix in prefix. Every row is run
+ * through minmax_line as it comes, as that's when it's in the cache, with
+ * line as its scratch. An erosion walks the rows and the lines backwards,
+ * image is its bottom row and stride negative. */
+static void minmax_rows(unsigned char *image, long stride, long width, long height, long n, int dilate, unsigned char *suffix, unsigned char *prefix, unsigned char *line) {
+	long k = n + 1;
+
+	for(long band = 0; band < height; band += k) {
+		long end = MIN(band + k, height);
+
+		for(long y = end - 1; y >= band; y--) {
+			unsigned char *row = image + y * stride;
+			unsigned char *dest = suffix + y % (2 * k) * width;
+
+			if(dilate) minmax_line(row, 1, width, n, dilate, line);
+			else minmax_line(row + width - 1, -1, width, n, dilate, line);
+			if(y == end - 1) {
+				memcpy(dest, row, width);
+			} else {
+				const unsigned char *below = suffix + (y + 1) % (2 * k) * width;
+				for(long x = 0; x < width; x++) dest[x] = extreme(dilate, below[x], row[x]);
+			}
 		}
 
-		ptr++;
-	}
+		for(long y = band; y < end; y++) {
+			unsigned char *row = image + y * stride;
+
+			if(y == band) memcpy(prefix, row, width);
+			else for(long x = 0; x < width; x++) prefix[x] = extreme(dilate, prefix[x], row[x]);
 
-	end = ary + (unsigned long)width * (height - 1);
-	for(ptr = ary; ptr < end; ptr++) ptr[0] = MIN(ptr[0], ptr[width]);
+			if(y < n) {
+				memcpy(row, prefix, width);
+			} else {
+				const unsigned char *window = suffix + (y - n) % (2 * k) * width;
+				for(long x = 0; x < width; x++) row[x] = extreme(dilate, window[x], prefix[x]);
+			}
+		}
+	}
 }
 
-/* Calculate how many pixels */
-static void process_minmax(void) {
-	float npix = sqrt(vpixel * hpixel); /* Average pixel */
+/* Calculate how many pixels. The max is over the pixel and the npix ones
+ * left and up of it, which shifts half pixel right and down per pixel, and
+ * the min over npix right and down, shifting back. Each costs the same
+ * whatever npix is. */
+static void process_minmax(struct OptarDecoder *decoder) {
+	float npix = sqrt(decoder->vpixel * decoder->hpixel); /* Average pixel */
 	npix *= minmax_filter;
 	npix = floor(npix);
 
-	if(npix) fprintf(stderr, "Doing %d cycles of max and %d cycles of min.\n", (int)npix, (int)npix);
+	if(!npix) return;
+	fprintf(stderr, "Doing %d cycles of max and %d cycles of min.\n", (int)npix, (int)npix);
 
-	for(int i = 1; i <= npix; i++) {
-		max();
-		fprintf(stderr, "%d ", i);
-	}
-	for(int i = 1; i <= npix; i++) {
-		min();
-		fprintf(stderr, "%d ", i);
+	long width = decoder->width, height = decoder->height, n = npix;
+	unsigned char *suffix = malloc(2 * (n + 1) * width);
+	unsigned char *prefix = malloc(width);
+	unsigned char *line = malloc(width);
+	if(!suffix || !prefix || !line) {
+		fprintf(stderr, "Cannot allocate min/max rows.\n");
+		exit(1);
 	}
-	if(npix) fprintf(stderr,"\n");
-}
 
-static void que_write(unsigned int x, unsigned int y) {
-	wptr->x = x;
-	wptr->y = y;
-	wptr++;
+	minmax_rows(decoder->ary, width, width, height, n, 1, suffix, prefix, line);
+	minmax_rows(decoder->ary + (height - 1) * width, -width, width, height, n, 0, suffix, prefix, line);
 
-	if(wptr >= que_end) wptr = que;
-	if(wptr == rptr) {
-		fprintf(stderr, "unoptar: Floodfill que overflowed. Search "
-			"for \"que=malloc\" in the program and increase the "
-			"size.\n");
-		exit(1);
-	}
+	free(suffix);
+	free(prefix);
+	free(line);
 }
 
-/* 1 OK, 0 empty */
-static int que_read(unsigned int *x, unsigned int *y) {
-	if(wptr == rptr) return 0; /* Empty */
-	*x = rptr->x;
-	*y = rptr->y;
-	rptr++;
-	if(rptr >= que_end) rptr = que;
-	return 1;
+/* Not filled yet and, if test, white in ary */
+static inline int fillable(struct OptarDecoder *decoder, unsigned long offset, char test) {
+	return decoder->newary[offset] && !(test && decoder->ary[offset] < decoder->fill_global_cutlevel);
 }
 
-static void init_que(void) {
-	rptr = que;
-	wptr = que;
+/* Pushes a seed onto fill_stack, which holds depth of them, and returns the
+ * new depth. The stack grows as needed. */
+static unsigned long push_seed(struct OptarDecoder *decoder, unsigned long depth, unsigned int x, unsigned int y) {
+	if(depth == decoder->fill_size) {
+		unsigned long size = MAX(decoder->fill_size * 2, decoder->width);
+		struct FillSeed *stack = realloc(decoder->fill_stack, size * sizeof(*stack));
+		if(!stack) {
+			fprintf(stderr, "Cannot allocate the fill stack.\n");
+			exit(1);
+		}
+		decoder->fill_stack = stack;
+		decoder->fill_size = size;
+	}
+	decoder->fill_stack[depth].x = x;
+	decoder->fill_stack[depth].y = y;
+
+	return depth + 1;
 }
 
-static void try_copy_white(unsigned int x, unsigned int y, char test) {
-	if(test && ary[(unsigned long)y * width + x] < fill_global_cutlevel) return; /* Black */
-	unsigned char *destptr = newary + (unsigned long)y * width + x;
-	if(!*destptr) return; /* Already copied through */
-	*destptr = 0;
-	que_write(x, y);
+/* Pushes a seed for every fillable run of row y touching x0 to x1 */
+static unsigned long push_runs(struct OptarDecoder *decoder, unsigned long depth, unsigned int x0, unsigned int x1, unsigned int y, char test) {
+	unsigned long row = (unsigned long)y * decoder->width;
+
+	for(unsigned int x = x0; x <= x1; x++) {
+		if(!fillable(decoder, row + x, test)) continue;
+		depth = push_seed(decoder, depth, x, y);
+		while(x < x1 && fillable(decoder, row + x + 1, test)) x++;
+	}
+
+	return depth;
 }
 
-/* Test: test for presence of white pixel in source, otherwise test just in
- * the destination */
-static void fill(unsigned int x, unsigned int y, char test) {
-	init_que();
-	try_copy_white(x, y, test);
-	while(que_read(&x, &y)) {
-		if(x + 1 < width)  try_copy_white(x + 1, y,     test);
-		if(x)              try_copy_white(x - 1, y,     test);
-		if(y + 1 < height) try_copy_white(x,     y + 1, test);
-		if(y)              try_copy_white(x,     y - 1, test);
+/* Zeroes the 4-connected area of newary around x, y. Test: test for presence
+ * of white pixel in source, otherwise test just in the destination. Goes row
+ * run by row run: a seed is widened to its whole run, which is filled, and
+ * the runs above and below it get a seed each, so the stack only holds
+ * runs. */
+static void fill(struct OptarDecoder *decoder, unsigned int x, unsigned int y, char test) {
+	unsigned long depth = push_seed(decoder, 0, x, y);
+
+	while(depth) {
+		depth--;
+		x = decoder->fill_stack[depth].x;
+		y = decoder->fill_stack[depth].y;
+
+		unsigned long row = (unsigned long)y * decoder->width;
+		if(!fillable(decoder, row + x, test)) continue; /* Filled since */
+
+		unsigned int left = x, right = x;
+		while(left && fillable(decoder, row + left - 1, test)) left--;
+		while(right + 1 < decoder->width && fillable(decoder, row + right + 1, test)) right++;
+		memset(decoder->newary + row + left, 0, right - left + 1);
+
+		if(y) depth = push_runs(decoder, depth, left, right, y - 1, test);
+		if(y + 1 < decoder->height) depth = push_runs(decoder, depth, left, right, y + 1, test);
 	}
 }
 
 /* Or newary to ary */
-static void erase_dirt(void) {
+static void erase_dirt(struct OptarDecoder *decoder) {
 	unsigned char *src, *dest;
 	unsigned char *destend;
 	unsigned long dirt_pixels = 0;
 
-	for(destend = ary + (unsigned long)width * height, src = newary, dest = ary; dest < destend; src++, dest++) {
+	for(destend = decoder->ary + (unsigned long)decoder->width * decoder->height, src = decoder->newary, dest = decoder->ary; dest < destend; src++, dest++) {
 		*dest |= *src;
 		dirt_pixels += *src & 1;
 	}
@@ -1275,45 +2040,35 @@ static void erase_dirt(void) {
 }
 
 /* Clobbers newary */
-static void remove_dirt_from_border(void) {
-	unsigned int que_size = ((unsigned long)MAX(width, height) << 1) + 5;
-	/* Not that I would really know the real bound */
-	que = malloc(que_size * sizeof(*que));
-	if(!que) {
-		fprintf(stderr, "Cannot allocate the fill que.\n");
-		exit(1);
-	}
-	que_end = que + que_size;
-
-	memset(newary, 0xff, (unsigned long)width * height);
-
-	fill(0, 0, 1);
-	fill(width >> 1, 0, 1);
-	fill(width - 1, 0, 1);
-	fill(0, height >> 1, 1);
-	fill(0, height - 1, 1);
-	fill(width - 1, height - 1, 1);
-	fill(width - 1, height >> 1, 1);
-	fill(width >> 1, height - 1, 1);
+static void remove_dirt_from_border(struct OptarDecoder *decoder) {
+	memset(decoder->newary, 0xff, (unsigned long)decoder->width * decoder->height);
+
+	fill(decoder, 0, 0, 1);
+	fill(decoder, decoder->width >> 1, 0, 1);
+	fill(decoder, decoder->width - 1, 0, 1);
+	fill(decoder, 0, decoder->height >> 1, 1);
+	fill(decoder, 0, decoder->height - 1, 1);
+	fill(decoder, decoder->width - 1, decoder->height - 1, 1);
+	fill(decoder, decoder->width - 1, decoder->height >> 1, 1);
+	fill(decoder, decoder->width >> 1, decoder->height - 1, 1);
 	fprintf(stderr, "white border identified, ");
-	fill(width >> 1, height >> 1, 0);
+	fill(decoder, decoder->width >> 1, decoder->height >> 1, 0);
 	fprintf(stderr, "data area identified, ");
 	/* Now white parts and the data area are filled with 0xff in newary. */
-	erase_dirt();
-	free(que);
+	erase_dirt(decoder);
 }
 
 /* Produces already linear output! */
-void read_png(void) {
+static void read_png(struct OptarDecoder *decoder) {
 	png_structp png_ptr = png_create_read_struct(PNG_LIBPNG_VER_STRING, NULL, NULL, NULL);
 	png_infop info_ptr = png_create_info_struct(png_ptr);
-	png_init_io(png_ptr,input_stream);
+	png_init_io(png_ptr,decoder->input_stream);
 	png_read_info(png_ptr, info_ptr);
 
-	width = png_get_image_width(png_ptr, info_ptr);
-	height = png_get_image_height(png_ptr, info_ptr);
+	decoder->width = png_get_image_width(png_ptr, info_ptr);
+	decoder->height = png_get_image_height(png_ptr, info_ptr);
 
-	fprintf(stderr, "Input %u x %u pixels, taking %G megabytes for 2 framebuffers.\n", width, height, 2 * (float)width * height / 1e6);
+	fprintf(stderr, "Input %u x %u pixels, taking %G megabytes for 2 framebuffers.\n", decoder->width, decoder->height, 2 * (float)decoder->width * decoder->height / 1e6);
 
 	double gamma; /* gamma from the info in the file */
 	if(png_get_gAMA(png_ptr, info_ptr, &gamma)) png_set_gamma(png_ptr, 1.0, gamma);
@@ -1351,162 +2106,336 @@ void read_png(void) {
 	 */
 	int number_of_passes = png_set_interlace_handling(png_ptr);
 	png_read_update_info(png_ptr, info_ptr);
-	ary = malloc((unsigned long)width * height);
-	newary = malloc((unsigned long)width * height);
-	if(!(ary && newary)) {
+	decoder->ary = malloc((unsigned long)decoder->width * decoder->height);
+	decoder->newary = malloc((unsigned long)decoder->width * decoder->height);
+	if(!(decoder->ary && decoder->newary)) {
 		fprintf(stderr, "Cannot allocate framebuffers.\n");
 		exit(1);
 	}
-	unsigned char **ptrs = malloc(height * sizeof(*ptrs));
+	unsigned char **ptrs = malloc(decoder->height * sizeof(*ptrs));
 	if(!ptrs) {
-		fprintf(stderr, "Cannot allocate %lu bytes for auxilliary buffer\n", height * (unsigned long)(sizeof(*ptrs)));
+		fprintf(stderr, "Cannot allocate %lu bytes for auxilliary buffer\n", decoder->height * (unsigned long)(sizeof(*ptrs)));
 		exit(1);
 	}
 
-	for(int y1 = 0; y1 < height; y1++) ptrs[y1] = ary + width * y1;
+	for(int y1 = 0; y1 < decoder->height; y1++) ptrs[y1] = decoder->ary + decoder->width * y1;
 	for(; number_of_passes; number_of_passes--) {
-		png_read_rows(png_ptr, ptrs, NULL, height);
+		png_read_rows(png_ptr, ptrs, NULL, decoder->height);
 	}
 
 	png_read_end(png_ptr, NULL);
 	free(ptrs);
-	fclose(input_stream);
+	fclose(decoder->input_stream);
+	build_pyramid(decoder);
 }
 
 
-/* The file must be already opened in input_stream. filename must be long enough
- * so that .png at the end can be replaced with _debug.pgm. */
-static void process_file(char *filename) {
-	fprintf(stderr, "Decoding PNG file %s...\n", filename);
-	read_png(); /* Reads *and* closes input_stream*/
+/* Copies an 8-bit grayscale image of the caller into ary */
+static void load_image(struct OptarDecoder *decoder, const unsigned char *image, unsigned int width, unsigned int height, size_t stride) {
+	decoder->width = width;
+	decoder->height = height;
+	decoder->ary = malloc((unsigned long)width * height);
+	decoder->newary = malloc((unsigned long)width * height);
+	if(!(decoder->ary && decoder->newary)) {
+		fprintf(stderr, "Cannot allocate framebuffers.\n");
+		exit(1);
+	}
 
-	calc_histogram();
-	analyze_cutlevel();
+	for(unsigned int y = 0; y < height; y++) memcpy(decoder->ary + (unsigned long)width * y, image + stride * y, width);
+	build_pyramid(decoder);
+}
+
+/* Decodes the image in ary into payload. Frees ary, but leaves newary with
+ * the debug image. */
+static void decode_page(struct OptarDecoder *decoder) {
+	calc_histogram(decoder);
+	analyze_cutlevel(decoder);
 	/* now fill_global_cutlevel and global_cutlevel are valid */
 
 	fprintf(stderr, "Removing dirt from the white border: ");
-	remove_dirt_from_border();
+	remove_dirt_from_border(decoder);
 
 	fprintf(stderr, "Searching for the corners.\n");
-	find_corners(); /* Also calculates chalf and pixel vectors. */
+	find_corners(decoder); /* Also calculates chalf and pixel vectors. */
 	/* After find_corners, hpixel and vpixel are valid. */
-	sync_crosses();
+	sync_crosses(decoder);
 
 	/* Minmax is before blur because before blur, narrow cracks and spots
 	 * can be distinguished in size from wide shallow depressions. Otherwise
 	 * we couldn't distinguish them apart - we would lose information. */
-	process_minmax();
-	blur_copy();
+	process_minmax(decoder);
+	blur_copy(decoder);
 
 	/* Prints the crashtest dummy marks. */
-	print_marks();
+	print_marks(decoder);
 
 	/* Now comes the decoding itself. */
-	read_syms();
-	free(ary);
-	free(search_area);
+	read_syms(decoder);
+	free(decoder->ary);
+	free(decoder->search_area);
+}
+
+/* The file must be already opened in input_stream. filename must be long enough
+ * so that .png at the end can be replaced with _debug.pgm. */
+static void process_file(struct OptarDecoder *decoder, char *filename) {
+	fprintf(stderr, "Decoding PNG file %s...\n", filename);
+	read_png(decoder); /* Reads *and* closes input_stream*/
+	decode_page(decoder);
 
 	strcpy((void *)(filename + strlen(filename) - 4), "_debug.pgm");
 	fprintf(stderr, "Writing debug image into %s.\n", filename);
-	dump_newary(filename); /* Also recompresses with gamma. */
-	free(newary);
+	dump_newary(decoder, filename); /* Also recompresses with gamma. */
+	free(decoder->newary);
 }
 
-static void process_files(char *base) {
-	unsigned int alloclen = strlen(base) + 1 + 4 + 1 + 5 + 1 + 3 + 1;
+/* Allocates a filename buffer for base, long enough for process_file */
+static char *alloc_filename(char *base, unsigned int *alloclen) {
+	*alloclen = strlen(base) + 1 + 4 + 1 + 5 + 1 + 3 + 1;
 	/* Longer filename */
-	char *longer = malloc(alloclen); /* _ 0001 _ debug . pgm \0 */
+	char *longer = malloc(*alloclen); /* _ 0001 _ debug . pgm \0 */
 	if(!longer){
 		fprintf(stderr, "unoptar: cannot allocate output base\n");
 		exit(1);
 	}
+	return longer;
+}
 
-	unsigned file_number = 0;
-	while(1) {
-		if(file_number >= 9999) {
-			fprintf(stderr, "unoptar: Too many pages - 10,000 or more.\n");
-			exit(1);
-		}
-		snprintf(longer, alloclen - 6,"%s_%04u.png", base, ++file_number);
-		/* 6 for "_debug" */
-
-		input_stream = fopen(longer, "r");
-		if(!input_stream) {
-			if (file_number == 1){
-				/* We didn't have any files! */
-				fprintf(stderr, "unoptar: cannot open %s: ", longer);
-				free(longer);
-				perror("");
-				exit(1);
-			} else {
-				free(longer);
-				return;
-			}
-		}
-		process_file(longer); /* Clobbers longer! Automatically closes input_stream! */
+/* Opens base_<file_number>.png into input_stream, returns 0 if it doesn't exist */
+static int open_file(struct OptarDecoder *decoder, char *longer, unsigned int alloclen, char *base, unsigned file_number) {
+	if(file_number > 9999) {
+		fprintf(stderr, "unoptar: Too many pages - 10,000 or more.\n");
+		exit(1);
 	}
-}
+	snprintf(longer, alloclen - 6,"%s_%04u.png", base, file_number);
+	/* 6 for "_debug" */
 
-// EXTERNAL FUNCTIONS START HERE
+	decoder->input_stream = fopen(longer, "r");
+	if(!decoder->input_stream && file_number == 1) {
+		/* We didn't have any files! */
+		fprintf(stderr, "unoptar: cannot open %s: ", longer);
+		perror("");
+		exit(1);
+	}
+	return decoder->input_stream != NULL;
+}
 
-void unoptar_file(struct PageFormat *format, char *input_basename) {
-    compute_constants(&unoptarconstants, format);
+static void process_files(struct OptarDecoder *decoder, char *base) {
+	unsigned int alloclen;
+	char *longer = alloc_filename(base, &alloclen);
 
-    //[constants.format->xcrosses][constants.format->ycrosses][2]
-	// initialize crosses (double)
-	crosses = (double ***)malloc(sizeof(double **) * unoptarconstants.format->xcrosses);
-	if(!crosses) {
-		fprintf(stderr, "Failed to allocate crosses\n");
-		exit(1);
+	for(unsigned file_number = 1; open_file(decoder, longer, alloclen, base, file_number); file_number++) {
+		process_file(decoder, longer); /* Clobbers longer! Automatically closes input_stream! */
+		write_payload(decoder, &decoder->header, decoder->payload);
 	}
+	free(longer);
+}
 
-	for(int x = 0; x < unoptarconstants.format->xcrosses; x++) {
-		crosses[x] = (double **)malloc(sizeof(double *) * unoptarconstants.format->ycrosses);
-		if(!crosses[x]) {
-			fprintf(stderr, "Failed to allocate crosses[%d]\n", x);
+/* Shared by the threads of process_files_parallel */
+struct DecodeJob {
+	struct OptarDecoder *decoder; /* The one writing the output */
+	char *base;
+	unsigned int pages;
+	unsigned int next; /* Next page to be taken by a worker, from 0 */
+	unsigned int written; /* Pages already written out */
+	unsigned int window; /* Max. pages decoded ahead of the writer */
+	unsigned char **payloads; /* [pages], NULL until decoded */
+	struct PageHeader *headers; /* [pages] */
+	int damaged; /* Some worker found a page damaged */
+	pthread_mutex_t lock;
+	pthread_cond_t cond;
+};
+
+static void *decode_worker(void *arg) {
+	struct DecodeJob *job = arg;
+	struct OptarDecoder *decoder = optar_decoder_create(&job->decoder->format, NULL);
+	decoder->sync_jobs = job->decoder->sync_jobs;
+	decoder->warm_start = job->decoder->warm_start;
+	unsigned int alloclen;
+	char *longer = alloc_filename(job->base, &alloclen);
+
+	pthread_mutex_lock(&job->lock);
+	while(job->next < job->pages) {
+		if(job->next >= job->written + job->window) {
+			/* Don't run too far ahead of the writer */
+			pthread_cond_wait(&job->cond, &job->lock);
+			continue;
+		}
+		unsigned int page = job->next++;
+		pthread_mutex_unlock(&job->lock);
+
+		if(!open_file(decoder, longer, alloclen, job->base, page + 1)) {
+			fprintf(stderr, "unoptar: cannot open %s: ", longer);
+			perror("");
 			exit(1);
 		}
+		process_file(decoder, longer);
 
-		for(int y = 0; y < unoptarconstants.format->ycrosses; y++) {
-			crosses[x][y] = (double *)malloc(sizeof(double) * 2);
-			if(!crosses[x][y]) {
-				fprintf(stderr, "Failed to allocate crosses[%d][%d]\n", x, y);
-				exit(1);
-			}
+		/* Hand the payload over and get a fresh one */
+		unsigned char *payload = decoder->payload;
+		decoder->payload = malloc((decoder->constants.netbits + 7) >> 3);
+		if(!decoder->payload) {
+			fprintf(stderr, "Failed to allocate payload\n");
+			exit(1);
 		}
+
+		pthread_mutex_lock(&job->lock);
+		job->headers[page] = decoder->header;
+		job->payloads[page] = payload;
+		pthread_cond_broadcast(&job->cond);
 	}
+	job->damaged |= decoder->damaged;
+	pthread_mutex_unlock(&job->lock);
 
-    //[constants.format->xcrosses][constants.format->ycrosses]
-	// initialize cutlevels (float)
-	cutlevels = (float **)malloc(sizeof(float *) * unoptarconstants.format->xcrosses);
-	if(!cutlevels) {
-		fprintf(stderr, "Failed to allocate cutlevels\n");
+	free(longer);
+	optar_decoder_destroy(decoder);
+	return NULL;
+}
+
+/* Like process_files, but decodes up to jobs pages at once. The payloads are
+ * written in page order, so the output is the same. */
+static void process_files_parallel(struct OptarDecoder *decoder, char *base, unsigned int jobs) {
+	struct DecodeJob job = {
+		.decoder = decoder,
+		.base = base,
+		.window = 2 * jobs
+	};
+	unsigned int alloclen;
+	char *longer = alloc_filename(base, &alloclen);
+
+	/* Count the pages first */
+	while(open_file(decoder, longer, alloclen, base, job.pages + 1)) {
+		fclose(decoder->input_stream);
+		job.pages++;
+	}
+	free(longer);
+
+	job.payloads = calloc(job.pages, sizeof(*job.payloads));
+	job.headers = calloc(job.pages, sizeof(*job.headers));
+	pthread_t *threads = malloc(jobs * sizeof(*threads));
+	if(!(job.payloads && job.headers && threads)) {
+		fprintf(stderr, "Failed to allocate decoding jobs\n");
 		exit(1);
 	}
+	pthread_mutex_init(&job.lock, NULL);
+	pthread_cond_init(&job.cond, NULL);
 
-	for(int x = 0; x < unoptarconstants.format->xcrosses; x++) {
-		cutlevels[x] = (float *)malloc(sizeof(float) * unoptarconstants.format->ycrosses);
-		if(!cutlevels[x]) {
-			fprintf(stderr, "Failed to allocate cutlevels[%d]\n", x);
+	for(unsigned int i = 0; i < jobs; i++) {
+		if(pthread_create(&threads[i], NULL, decode_worker, &job)) {
+			fprintf(stderr, "unoptar: cannot start decoding thread\n");
 			exit(1);
 		}
 	}
 
-    print_chan_info();
-    process_files(input_basename);
+	for(unsigned int page = 0; page < job.pages; page++) {
+		pthread_mutex_lock(&job.lock);
+		while(!job.payloads[page]) pthread_cond_wait(&job.cond, &job.lock);
+		pthread_mutex_unlock(&job.lock);
+
+		write_payload(decoder, &job.headers[page], job.payloads[page]);
+		free(job.payloads[page]);
+
+		pthread_mutex_lock(&job.lock);
+		job.written++;
+		pthread_cond_broadcast(&job.cond);
+		pthread_mutex_unlock(&job.lock);
+	}
+
+	for(unsigned int i = 0; i < jobs; i++) pthread_join(threads[i], NULL);
+	decoder->damaged |= job.damaged;
+
+	pthread_cond_destroy(&job.cond);
+	pthread_mutex_destroy(&job.lock);
+	free(threads);
+	free(job.payloads);
+	free(job.headers);
+}
+
+// EXTERNAL FUNCTIONS START HERE
 
-    // free cutlevels
-	for(int x = 0; x < unoptarconstants.format->xcrosses; x++) {
-		free(cutlevels[x]);
+struct OptarDecoder *optar_decoder_create(struct PageFormat *format, FILE *output_stream) {
+	struct OptarDecoder *decoder = calloc(1, sizeof(*decoder));
+	if(!decoder) {
+		fprintf(stderr, "Failed to allocate decoder\n");
+		exit(1);
 	}
-	free(cutlevels);
 
-	// free crosses
-	for(int x = 0; x < unoptarconstants.format->xcrosses; x++) {
-		for(int y = 0; y < unoptarconstants.format->ycrosses; y++) {
-			free(crosses[x][y]);
-		}
-		free(crosses[x]);
+	decoder->format = *format;
+	compute_constants(&decoder->constants, &decoder->format);
+	decoder->output_stream = output_stream;
+	decoder->next_page = 1;
+	decoder->length = OPTAR_UNKNOWN_LENGTH;
+
+	/* Flat, one block each, reused for every page */
+	unsigned int total = decoder->constants.format->xcrosses * decoder->constants.format->ycrosses;
+	decoder->crosses = malloc(sizeof(*decoder->crosses) * total);
+	decoder->cutlevels = malloc(sizeof(*decoder->cutlevels) * total);
+	decoder->cells = malloc(sizeof(*decoder->cells) * (decoder->constants.format->xcrosses - 1) * (decoder->constants.format->ycrosses - 1));
+	decoder->channel_bits = malloc(decoder->constants.totalbits);
+	if(!(decoder->crosses && decoder->cutlevels && decoder->cells && decoder->channel_bits)) {
+		fprintf(stderr, "Failed to allocate the sampling buffers\n");
+		exit(1);
 	}
-	free(crosses);
-}
\ No newline at end of file
+	alloc_symbols(decoder);
+	decoder->layout = page_layout(&decoder->constants);
+
+	return decoder;
+}
+
+struct OptarDecoder *optar_decoder_create_sink(struct PageFormat *format, OptarPayloadSink sink, void *opaque) {
+	struct OptarDecoder *decoder = optar_decoder_create(format, NULL);
+	decoder->sink = sink;
+	decoder->sink_opaque = opaque;
+
+	return decoder;
+}
+
+void optar_decoder_page(struct OptarDecoder *decoder, const unsigned char *image, unsigned int width, unsigned int height, size_t stride) {
+	load_image(decoder, image, width, height, stride);
+	decode_page(decoder);
+	free(decoder->newary);
+	write_payload(decoder, &decoder->header, decoder->payload);
+}
+
+void optar_decoder_sync_jobs(struct OptarDecoder *decoder, unsigned int jobs) {
+	decoder->sync_jobs = jobs;
+}
+
+void optar_decoder_warm_start(struct OptarDecoder *decoder, int on) {
+	decoder->warm_start = on;
+}
+
+void optar_decoder_files(struct OptarDecoder *decoder, char *input_basename, unsigned int jobs) {
+	print_chan_info(decoder);
+	if(jobs > 1) process_files_parallel(decoder, input_basename, jobs);
+	else process_files(decoder, input_basename);
+}
+
+int optar_decoder_finish(struct OptarDecoder *decoder) {
+	check_complete(decoder);
+	return !decoder->damaged;
+}
+
+void optar_decoder_destroy(struct OptarDecoder *decoder) {
+	if(!decoder->finished && (decoder->next_page > 1 || decoder->n_pending)) check_complete(decoder);
+	free(decoder->payload);
+	free(decoder->words);
+	free(decoder->data);
+	free(decoder->syndromes);
+	free(decoder->channel_bits);
+	free(decoder->cells);
+	free(decoder->fill_stack);
+	page_layout_release(decoder->layout);
+	free(decoder->warm_crosses);
+	free(decoder->cutlevels);
+	free(decoder->crosses);
+	free(decoder);
+}
+
+int unoptar_file(struct PageFormat *format, char *input_basename) {
+	struct OptarDecoder *decoder = optar_decoder_create(format, stdout);
+	optar_decoder_files(decoder, input_basename, 1);
+	int intact = optar_decoder_finish(decoder);
+	optar_decoder_destroy(decoder);
+
+	return intact;
+}
@@ -1,5 +1,8 @@
 // Copyright (c) GPL 2024 Arkanic <https://github.com/Arkanic>
 
+#include <stddef.h> /* size_t */
+#include <stdio.h> /* FILE */
+
 /* configuration struct of optar page */
 struct PageFormat {
 	// provided values
@@ -54,6 +57,9 @@ struct PageConstants {
 	// Total bits before hamming including the unused
 	unsigned long long totalbits;
 
+	// A copy of the page header at either end of the channel, the payload in between
+	unsigned long long headerbits;
+
 	// changes based on golay/hamming via fec_order
 	unsigned int fec_largebits;
 	unsigned int fec_smallbits;
@@ -62,6 +68,7 @@ struct PageConstants {
 	unsigned long long fec_syms;
 	unsigned long long netbits; // Net payload bits
 	unsigned long long usedbits; // Used raw bits to store hamming/golay symbols
+	unsigned long page_bytes; // Payload bytes per page, pages start on byte boundaries
 };
 
 
@@ -73,14 +80,111 @@ void prefill_pageformat(struct PageFormat *format);
 
 // liboptar.c
 
-/* Create a series of optar files from an input file and configuration object. Returns the number of pages generated. */
-int optar_file(struct PageFormat *format, char *input_filename, char *output_basename);
+struct PageDimensions;
+
+/* File format of the pages the encoder writes */
+enum OutputType {
+	OUTPUT_PGM, /* <basename>_0001.pgm, ... 8 bits per pixel */
+	OUTPUT_PBM, /* <basename>_0001.pbm, ... 1 bit per pixel, 8x smaller */
+	OUTPUT_PNG, /* <basename>_0001.png, ... 1 bit per pixel, compressed on a separate thread */
+	OUTPUT_PDF, /* All pages in <basename>.pdf, or on stdout for basename "-" */
+	OUTPUT_BITMAP /* No files, every page goes to the sink */
+};
+
+/* Receives finished page number page (from 1) for OUTPUT_BITMAP. The bitmap is
+ * width x height pixels, stride bytes per row, packed like in PBM: MSB is the
+ * leftmost pixel, 1 is black. It is only valid during the call. */
+typedef void (*OptarPageSink)(void *opaque, unsigned int page, const unsigned char *bitmap, unsigned long width, unsigned long height, unsigned int stride);
+
+struct OutputFormat {
+	enum OutputType type;
+	int zlib_level; /* Compression level 0-9 for OUTPUT_PNG and OUTPUT_PDF */
+
+	/* Physical size of OUTPUT_PDF pages */
+	struct PageDimensions *paper; /* The image is centered on it, NULL for paper as large as the image */
+	double density; /* Pixels per mm */
+
+	/* OUTPUT_BITMAP. With optar_file_parallel, the sink is called from
+	 * several threads and the pages come in any order. */
+	OptarPageSink sink;
+	void *opaque; /* Passed to the sink */
+};
+
+/* Encoder state. Independent encoders can run concurrently on different threads. */
+struct OptarEncoder;
+
+/* input_length of a stream which can't tell its length in advance, like a
+ * pipe. The pages then say "1/?" until optar_encoder_finish, which puts the
+ * real page count into the files already written. Bitmap sinks keep the "?". */
+#define OPTAR_UNKNOWN_LENGTH (~0ULL)
+
+/* Start encoding input_length bytes into <output_basename>_0001.pgm, ... The format and output must outlive the encoder. */
+struct OptarEncoder *optar_encoder_create(struct PageFormat *format, struct OutputFormat *output, char *output_basename, unsigned long long input_length);
+
+/* Encode the next len bytes of the input */
+void optar_encoder_feed(struct OptarEncoder *encoder, const void *data, size_t len);
+
+/* Flush the last page. Returns the number of pages generated. */
+int optar_encoder_finish(struct OptarEncoder *encoder);
+
+void optar_encoder_destroy(struct OptarEncoder *encoder);
+
+/* Create a series of optar files from an input file ("-" for stdin) and configuration object. Returns the number of pages generated. */
+int optar_file(struct PageFormat *format, struct OutputFormat *output, char *input_filename, char *output_basename);
+
+/* Like optar_file, but encodes len bytes from memory. label takes the place of the output basename
+ * for the file names and the page footers. */
+int optar_buffer(struct PageFormat *format, struct OutputFormat *output, const void *data, size_t len, char *label);
+
+/* Like optar_file, but renders up to jobs pages at once on separate threads. Input which can't seek is encoded on one thread. */
+int optar_file_parallel(struct PageFormat *format, struct OutputFormat *output, char *input_filename, char *output_basename, unsigned int jobs);
 
 
 // libunoptar.c
 
-/* Parse a series of optar files from an input basename and configuration object */
-void unoptar_file(struct PageFormat *format, char *input_basename);
+/* Decoder state. Independent decoders can run concurrently on different threads. */
+struct OptarDecoder;
+
+/* Prepare decoding pages of the given format, writing the payload into output_stream. The format is copied: the header
+ * on every page tells the decoder the page number, the payload length and a different fec_order, but the other digits
+ * must be given right, since they say where the crosses and the header are. A page whose header disagrees about them
+ * is decoded as if it had none. */
+struct OptarDecoder *optar_decoder_create(struct PageFormat *format, FILE *output_stream);
+
+/* Receives decoded payload */
+typedef void (*OptarPayloadSink)(void *opaque, const void *data, size_t len);
+
+/* Like optar_decoder_create, but the payload goes to the sink */
+struct OptarDecoder *optar_decoder_create_sink(struct PageFormat *format, OptarPayloadSink sink, void *opaque);
+
+/* Decode the next page from a scan in memory: width x height pixels of linear 8-bit gray, stride bytes per row.
+ * The image stays the caller's and isn't modified. Pages can come in any order, a page is held back until the ones
+ * before it are written out. */
+void optar_decoder_page(struct OptarDecoder *decoder, const unsigned char *image, unsigned int width, unsigned int height, size_t stride);
+
+/* Find the crosses of every page from a projection fitted to the whole page, on jobs threads at once, rather than each
+ * one from the one before it. 0, the default, is the latter, which follows a page bent out of shape better. */
+void optar_decoder_sync_jobs(struct OptarDecoder *decoder, unsigned int jobs);
+
+/* Start finding the crosses of every page but the first from where they were on the page before, moved like the
+ * corners, searching only half as far around them. Made for a stack of pages through the same scanner; a page which
+ * moved some other way is found from scratch. Off by default. */
+void optar_decoder_warm_start(struct OptarDecoder *decoder, int on);
+
+/* Decode <input_basename>_0001.png, <input_basename>_0002.png, ... until one is missing. The files can be in any order.
+ * With jobs > 1 that many pages are decoded at once on separate threads; the output stays the same. */
+void optar_decoder_files(struct OptarDecoder *decoder, char *input_basename, unsigned int jobs);
+
+/* Reports the pages which are missing. Returns 1 if every page came with a readable header and an intact payload and
+ * the output is complete, 0 if not. */
+int optar_decoder_finish(struct OptarDecoder *decoder);
+
+/* Reports the pages which are missing, unless optar_decoder_finish did */
+void optar_decoder_destroy(struct OptarDecoder *decoder);
+
+/* Parse a series of optar files from an input basename and configuration object, payload goes to stdout. Returns like
+ * optar_decoder_finish. */
+int unoptar_file(struct PageFormat *format, char *input_basename);
 
 
 
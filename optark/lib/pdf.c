@@ -0,0 +1,229 @@
+// Copyright (c) GPL 2024 Arkanic <https://github.com/Arkanic>
+
+/* Multi-page PDF output. Every page is one 1-bit image XObject, compressed
+ * with zlib and placed at its physical size in the middle of the paper. The
+ * file is written strictly front to back, so it can go into a pipe: the page
+ * tree and catalog come after the pages and the cross-reference table is made
+ * from the offsets counted along the way. When the page count isn't known
+ * while the pages are written, every page also draws a label strip over its
+ * own label, and the strips with the final labels follow the pages. */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
+#include <zlib.h>
+
+#include "lib.h"
+
+#define PT_PER_MM (72 / 25.4)
+
+/* Objects 1 and 2 are the catalog and the page tree, page n (from 0) is made
+ * of objects 3 + 3n (page), 4 + 3n (contents) and 5 + 3n (image). With late
+ * labels it's 3 + 4n, ... and 6 + 4n is the label strip. */
+#define PAGE_OBJECT(pdf, n) (3 + (pdf)->page_objects * (n))
+
+static void pdf_printf(struct PdfWriter *pdf, const char *fmt, ...) {
+	va_list ap;
+
+	va_start(ap, fmt);
+	int written = vfprintf(pdf->stream, fmt, ap);
+	va_end(ap);
+	if(written < 0) {
+		fprintf(stderr, "optar: cannot write %s\n", pdf->filename);
+		exit(1);
+	}
+	pdf->offset += written;
+}
+
+static void pdf_write(struct PdfWriter *pdf, const void *data, size_t len) {
+	if(fwrite(data, 1, len, pdf->stream) != len) {
+		fprintf(stderr, "optar: cannot write %s\n", pdf->filename);
+		exit(1);
+	}
+	pdf->offset += len;
+}
+
+/* Records where object number starts */
+static void pdf_object(struct PdfWriter *pdf, unsigned int number) {
+	if(number >= pdf->objects_size) {
+		pdf->objects_size = 2 * number;
+		pdf->objects = realloc(pdf->objects, sizeof(*pdf->objects) * pdf->objects_size);
+		if(!pdf->objects) {
+			fprintf(stderr, "Cannot allocate PDF object table\n");
+			exit(1);
+		}
+	}
+	pdf->objects[number] = pdf->offset;
+	pdf_printf(pdf, "%u 0 obj\n", number);
+}
+
+/* Compresses a packed bitmap, 1 is black. Returns a malloc'd buffer. */
+static unsigned char *pdf_compress(struct PdfWriter *pdf, unsigned int page, unsigned char *ary, unsigned long len, uLongf *packed_len) {
+	*packed_len = compressBound(len);
+	unsigned char *packed = malloc(*packed_len);
+	if(!packed) {
+		fprintf(stderr, "Cannot allocate compressed page\n");
+		exit(1);
+	}
+	if(compress2(packed, packed_len, ary, len, pdf->level) != Z_OK) {
+		fprintf(stderr, "optar: cannot compress page %u\n", page + 1);
+		exit(1);
+	}
+
+	return packed;
+}
+
+/* Writes the body of an image object made by pdf_compress */
+static void pdf_image(struct PdfWriter *pdf, unsigned char *packed, uLongf packed_len, unsigned long width, unsigned long height) {
+	/* In DeviceGray 0 is black, hence the Decode */
+	pdf_printf(pdf, "<< /Type /XObject /Subtype /Image /Width %lu /Height %lu\n"
+		"/ColorSpace /DeviceGray /BitsPerComponent 1 /Decode [1 0]\n"
+		"/Filter /FlateDecode /Length %lu >>\nstream\n",
+		width, height, (unsigned long)packed_len);
+	pdf_write(pdf, packed, packed_len);
+	pdf_printf(pdf, "\nendstream\nendobj\n");
+}
+
+/* Pages go to <basename>.pdf, or to stdout if basename is "-". The image
+ * is constants->width x height pixels of output->density per mm, the paper
+ * is output->paper or just as large as the image. With late_labels, every
+ * page needs a pdf_label before pdf_close. */
+struct PdfWriter *pdf_open(struct OutputFormat *output, struct PageConstants *constants, char *basename, int late_labels) {
+	struct PdfWriter *pdf = calloc(1, sizeof(*pdf));
+	if(!pdf) {
+		fprintf(stderr, "Cannot allocate PDF writer\n");
+		exit(1);
+	}
+
+	if(!strcmp(basename, "-")) {
+		pdf->stream = stdout;
+		pdf->filename = strdup("standard output");
+	} else {
+		pdf->filename = malloc(strlen(basename) + 5);
+		if(pdf->filename) sprintf(pdf->filename, "%s.pdf", basename);
+	}
+	if(!pdf->filename) {
+		fprintf(stderr, "Cannot allocate PDF filename\n");
+		exit(1);
+	}
+	if(!pdf->stream) {
+		pdf->stream = fopen(pdf->filename, "wb");
+		if(!pdf->stream) {
+			fprintf(stderr, "optar: cannot open %s for writing.\n", pdf->filename);
+			exit(1);
+		}
+	}
+
+	pdf->level = output->zlib_level;
+	pdf->page_objects = late_labels ? 4 : 3;
+	pdf->label_y = constants->format->border + constants->data_height;
+	pdf->label_height = constants->format->text_height;
+	pdf->image_width = constants->width / output->density * PT_PER_MM;
+	pdf->image_height = constants->height / output->density * PT_PER_MM;
+	if(output->paper) {
+		pdf->paper_width = output->paper->width * PT_PER_MM;
+		pdf->paper_height = output->paper->height * PT_PER_MM;
+	} else {
+		pdf->paper_width = pdf->image_width;
+		pdf->paper_height = pdf->image_height;
+	}
+	pthread_mutex_init(&pdf->lock, NULL);
+	pthread_cond_init(&pdf->cond, NULL);
+
+	/* The binary comment tells file transfer programs it's not text */
+	pdf_printf(pdf, "%%PDF-1.4\n%%\xe2\xe3\xcf\xd3\n");
+
+	return pdf;
+}
+
+/* Writes page number page (from 0). ary is a packed bitmap like in PBM, 1 is
+ * black. Callable from several threads at once; the compression runs in
+ * parallel and the pages are written in order, so a thread waits until
+ * all the pages before its one are written. */
+void pdf_page(struct PdfWriter *pdf, unsigned int page, unsigned char *ary, unsigned int stride, unsigned long width, unsigned long height) {
+	uLongf packed_len;
+	unsigned char *packed = pdf_compress(pdf, page, ary, (unsigned long)stride * height, &packed_len);
+
+	/* Image in the middle of the paper, the label strip over its label */
+	double x = (pdf->paper_width - pdf->image_width) / 2;
+	double y = (pdf->paper_height - pdf->image_height) / 2;
+	char contents[256];
+	int contents_len = snprintf(contents, sizeof(contents), "q %.4f 0 0 %.4f %.4f %.4f cm /Im0 Do Q\n",
+		pdf->image_width, pdf->image_height, x, y);
+	if(pdf->page_objects == 4) {
+		contents_len += snprintf(contents + contents_len, sizeof(contents) - contents_len, "q %.4f 0 0 %.4f %.4f %.4f cm /Lb0 Do Q\n",
+			pdf->image_width, pdf->image_height * pdf->label_height / height,
+			x, y + pdf->image_height * (height - pdf->label_y - pdf->label_height) / height);
+	}
+
+	pthread_mutex_lock(&pdf->lock);
+	while(pdf->pages != page) pthread_cond_wait(&pdf->cond, &pdf->lock);
+
+	unsigned int object = PAGE_OBJECT(pdf, page);
+	pdf_object(pdf, object);
+	pdf_printf(pdf, "<< /Type /Page /Parent 2 0 R /MediaBox [0 0 %.4f %.4f]\n"
+		"/Resources << /XObject << /Im0 %u 0 R",
+		pdf->paper_width, pdf->paper_height, object + 2);
+	if(pdf->page_objects == 4) pdf_printf(pdf, " /Lb0 %u 0 R", object + 3);
+	pdf_printf(pdf, " >> >> /Contents %u 0 R >>\nendobj\n", object + 1);
+
+	pdf_object(pdf, object + 1);
+	pdf_printf(pdf, "<< /Length %d >>\nstream\n", contents_len);
+	pdf_write(pdf, contents, contents_len);
+	pdf_printf(pdf, "endstream\nendobj\n");
+
+	pdf_object(pdf, object + 2);
+	pdf_image(pdf, packed, packed_len, width, height);
+
+	pdf->pages++;
+	pthread_cond_broadcast(&pdf->cond);
+	pthread_mutex_unlock(&pdf->lock);
+
+	free(packed);
+}
+
+/* Writes the label strip of page number page (from 0), label_height rows
+ * from rows on. Only after all the pages. */
+void pdf_label(struct PdfWriter *pdf, unsigned int page, unsigned char *rows, unsigned int stride, unsigned long width) {
+	uLongf packed_len;
+	unsigned char *packed = pdf_compress(pdf, page, rows, (unsigned long)stride * pdf->label_height, &packed_len);
+
+	pdf_object(pdf, PAGE_OBJECT(pdf, page) + 3);
+	pdf_image(pdf, packed, packed_len, width, pdf->label_height);
+
+	free(packed);
+}
+
+/* Writes the page tree, catalog and cross-reference table and frees pdf */
+void pdf_close(struct PdfWriter *pdf) {
+	pdf_object(pdf, 2);
+	pdf_printf(pdf, "<< /Type /Pages /Count %u /Kids [", pdf->pages);
+	for(unsigned int page = 0; page < pdf->pages; page++) {
+		pdf_printf(pdf, "%s%u 0 R", page % 8 ? " " : "\n", PAGE_OBJECT(pdf, page));
+	}
+	pdf_printf(pdf, "] >>\nendobj\n");
+
+	pdf_object(pdf, 1);
+	pdf_printf(pdf, "<< /Type /Catalog /Pages 2 0 R >>\nendobj\n");
+
+	/* Every entry is exactly 20 bytes */
+	unsigned long long xref = pdf->offset;
+	unsigned int size = PAGE_OBJECT(pdf, pdf->pages);
+	pdf_printf(pdf, "xref\n0 %u\n0000000000 65535 f \n", size);
+	for(unsigned int object = 1; object < size; object++) {
+		pdf_printf(pdf, "%010llu 00000 n \n", pdf->objects[object]);
+	}
+	pdf_printf(pdf, "trailer\n<< /Size %u /Root 1 0 R >>\nstartxref\n%llu\n%%%%EOF\n", size, xref);
+
+	if(pdf->stream == stdout ? fflush(pdf->stream) : fclose(pdf->stream)) {
+		fprintf(stderr, "optar: cannot write %s\n", pdf->filename);
+		exit(1);
+	}
+
+	pthread_cond_destroy(&pdf->cond);
+	pthread_mutex_destroy(&pdf->lock);
+	free(pdf->objects);
+	free(pdf->filename);
+	free(pdf);
+}
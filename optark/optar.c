@@ -2,6 +2,7 @@
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include "lib/optark.h"
 #include "arg.h"
@@ -15,6 +16,8 @@ void showhelp(void) {
 		"\n"
 		"Takes the input file as the data payload and produces <output filename>_<0...n>.pgm files which contain"
 		"the input file encoded as a multiple images with error correction, ready to be printed.\n"
+		"An input file of \"-\" reads stdin. As the page count of a pipe is only known at its end, the pages are\n"
+		"labelled \"n/?\" while they are written and fixed up afterwards.\n"
 		"\n"
 		"Options:\n"
 		"--help      -h                 display this message\n"
@@ -23,6 +26,12 @@ void showhelp(void) {
 		"--density <density>            pixel density of the generated output. Higher density means more content stored per page,\n"
 		"                               but increases the printer and scanner precision required. 3.5 is a good default for inkjet printers.\n"
 		"--capacities                   prints out the capacities of various sizes at the current density\n"
+		"--jobs      -j <n>             render n pages at once on separate threads\n"
+		"--output-format <pgm|pbm|png|pdf>\n"
+		"                               file format of the pages. pbm and png take 1 bit per pixel instead of 8, png is also compressed.\n"
+		"                               pdf writes all pages into <output filename>.pdf at their printed size, or to stdout for \"-\".\n"
+		"                               Default is pgm.\n"
+		"--compression <0-9>            zlib compression level of png and pdf output, default 6\n"
 		"\n"
 		"Notes:\n"
 		"Optar will default to A4 size with a pixel density of 3.5 unless otherwise specified.\n"
@@ -35,6 +44,8 @@ struct {
 	unsigned short landscape;
 
 	unsigned short capacities;
+	unsigned int jobs;
+	struct OutputFormat output;
 } configuration = {
 	.capacities = 0
 };
@@ -93,7 +104,48 @@ struct ArgHandle capacitiesarg = {
 	.handlearg = &capacitiesarg_cb
 };
 
-static struct ArgHandle *arghandles[] = {&helparg, &formatarg, &densityarg, /*&landscapearg,*/ &capacitiesarg};
+void jobsarg_cb(char *raw) {
+	if(sscanf(raw, "%u", &configuration.jobs) != 1 || !configuration.jobs) {
+		fprintf(stderr, "Invalid number of jobs \"%s\"\n", raw);
+		exit(1);
+	}
+}
+struct ArgHandle jobsarg = {
+	.name = "jobs",
+	.shortname = 'j',
+	.datafield = 1,
+	.handlearg = &jobsarg_cb
+};
+
+void outputformatarg_cb(char *raw) {
+	if(!strcmp(raw, "pgm")) configuration.output.type = OUTPUT_PGM;
+	else if(!strcmp(raw, "pbm")) configuration.output.type = OUTPUT_PBM;
+	else if(!strcmp(raw, "png")) configuration.output.type = OUTPUT_PNG;
+	else if(!strcmp(raw, "pdf")) configuration.output.type = OUTPUT_PDF;
+	else {
+		fprintf(stderr, "Unknown output format \"%s\"\n", raw);
+		exit(1);
+	}
+}
+struct ArgHandle outputformatarg = {
+	.name = "output-format",
+	.datafield = 1,
+	.handlearg = &outputformatarg_cb
+};
+
+void compressionarg_cb(char *raw) {
+	if(sscanf(raw, "%d", &configuration.output.zlib_level) != 1 || configuration.output.zlib_level < 0 || configuration.output.zlib_level > 9) {
+		fprintf(stderr, "Invalid compression level \"%s\"\n", raw);
+		exit(1);
+	}
+}
+struct ArgHandle compressionarg = {
+	.name = "compression",
+	.datafield = 1,
+	.handlearg = &compressionarg_cb
+};
+
+static struct ArgHandle *arghandles[] = {&helparg, &formatarg, &densityarg, /*&landscapearg,*/ &capacitiesarg, &jobsarg, &outputformatarg, &compressionarg};
 
 void prettyprintsize(unsigned long long bits) {
 	unsigned long long bytes = bits / 8;
@@ -110,6 +162,9 @@ int main(int argc, char *argv[]) {
 	configuration.density = 3.5;
 	configuration.format = dimensions_get("A4");
 	configuration.landscape = 0;
+	configuration.jobs = 1;
+	configuration.output.type = OUTPUT_PGM;
+	configuration.output.zlib_level = 6;
 
 	char *inputoutput[2];
 	int result = arg_parse(sizeof(arghandles) / sizeof(arghandles[0]), arghandles, 2, inputoutput, argc, argv);
@@ -170,7 +225,10 @@ int main(int argc, char *argv[]) {
 	}
 
 	dimensions_createconfig(&format, configuration.format, configuration.density);
-	optar_file(&format, inputoutput[0], inputoutput[1]);
+	configuration.output.paper = configuration.format;
+	configuration.output.density = configuration.density;
+	if(configuration.jobs > 1) optar_file_parallel(&format, &configuration.output, inputoutput[0], inputoutput[1], configuration.jobs);
+	else optar_file(&format, &configuration.output, inputoutput[0], inputoutput[1]);
 
 	return 0;
 }
\ No newline at end of file
@@ -7,6 +7,9 @@
 #include "arg.h"
 
 struct PageFormat format;
+unsigned int jobs = 1;
+unsigned int sync_jobs = 0;
+int warm_start = 0;
 
 void showhelp(void) {
 	fprintf(stderr,
@@ -17,9 +20,16 @@ void showhelp(void) {
 		"The second argument is the filename base before the underscore, in this case \"example\":\n"
 		"unoptar 0-33-47-24-3-1-2-24 example > example.txt\n"
 		"where example.txt is replaced with whatever filename/format the original document contained.\n"
+		"Every page carries a header with its number, so the scans can be numbered in any order. The header also\n"
+		"corrects the error correction digit of the format and tells where the payload ends. A page whose header\n"
+		"disagrees about the other digits is decoded without it, they place the crosses.\n"
+		"The exit status is 1 if a page was missing, damaged or without a readable header, or the output came out short.\n"
 		"\n"
 		"Options:\n"
 		"--help -h                 display this message\n"
+		"--jobs -j <n>             decode n pages at once on separate threads\n"
+		"--sync-jobs -s <n>        find the crosses of a page from a model of the whole page, on n threads\n"
+		"--warm-start -w           find the crosses of a page from where they were on the page before\n"
 	);
 }
 
@@ -34,7 +44,43 @@ struct ArgHandle helparg = {
 	.handlearg = &helparg_cb
 };
 
-static struct ArgHandle *arghandles[] = {&helparg};
+void jobsarg_cb(char *raw) {
+	if(sscanf(raw, "%u", &jobs) != 1 || !jobs) {
+		fprintf(stderr, "Invalid number of jobs \"%s\"\n", raw);
+		exit(1);
+	}
+}
+struct ArgHandle jobsarg = {
+	.name = "jobs",
+	.shortname = 'j',
+	.datafield = 1,
+	.handlearg = &jobsarg_cb
+};
+
+void syncjobsarg_cb(char *raw) {
+	if(sscanf(raw, "%u", &sync_jobs) != 1 || !sync_jobs) {
+		fprintf(stderr, "Invalid number of sync jobs \"%s\"\n", raw);
+		exit(1);
+	}
+}
+struct ArgHandle syncjobsarg = {
+	.name = "sync-jobs",
+	.shortname = 's',
+	.datafield = 1,
+	.handlearg = &syncjobsarg_cb
+};
+
+void warmstartarg_cb(char *dummy) {
+	warm_start = 1;
+}
+struct ArgHandle warmstartarg = {
+	.name = "warm-start",
+	.shortname = 'w',
+	.datafield = 0,
+	.handlearg = &warmstartarg_cb
+};
+
+static struct ArgHandle *arghandles[] = {&helparg, &jobsarg, &syncjobsarg, &warmstartarg};
 
 static void parse_format(struct PageFormat *pageformat, char *format) {
 	unsigned int dummy;
@@ -80,7 +126,12 @@ int main(int argc, char *argv[]) {
 	}
 
 	parse_format(&format, inputoutput[0]);
-	unoptar_file(&format, inputoutput[1]);
+	struct OptarDecoder *decoder = optar_decoder_create(&format, stdout);
+	optar_decoder_sync_jobs(decoder, sync_jobs);
+	optar_decoder_warm_start(decoder, warm_start);
+	optar_decoder_files(decoder, inputoutput[1], jobs);
+	int intact = optar_decoder_finish(decoder);
+	optar_decoder_destroy(decoder);
 
-	return 0;
+	return intact ? 0 : 1;
 }
\ No newline at end of file
@@ -0,0 +1,4098 @@
+unsigned long golay_codes[4096]={
+0x000000,
+0x00183f,
+0x00258f,
+0x003db0,
+0x0042e7,
+0x005ad8,
+0x006768,
+0x007f57,
+0x008573,
+0x009d4c,
+0x00a0fc,
+0x00b8c3,
+0x00c794,
+0x00dfab,
+0x00e21b,
+0x00fa24,
+0x0106b9,
+0x011e86,
+0x012336,
+0x013b09,
+0x01445e,
+0x015c61,
+0x0161d1,
+0x0179ee,
+0x0183ca,
+0x019bf5,
+0x01a645,
+0x01be7a,
+0x01c12d,
+0x01d912,
+0x01e4a2,
+0x01fc9d,
+0x02035d,
+0x021b62,
+0x0226d2,
+0x023eed,
+0x0241ba,
+0x025985,
+0x026435,
+0x027c0a,
+0x02862e,
+0x029e11,
+0x02a3a1,
+0x02bb9e,
+0x02c4c9,
+0x02dcf6,
+0x02e146,
+0x02f979,
+0x0305e4,
+0x031ddb,
+0x03206b,
+0x033854,
+0x034703,
+0x035f3c,
+0x03628c,
+0x037ab3,
+0x038097,
+0x0398a8,
+0x03a518,
+0x03bd27,
+0x03c270,
+0x03da4f,
+0x03e7ff,
+0x03ffc0,
+0x040bac,
+0x041393,
+0x042e23,
+0x04361c,
+0x04494b,
+0x045174,
+0x046cc4,
+0x0474fb,
+0x048edf,
+0x0496e0,
+0x04ab50,
+0x04b36f,
+0x04cc38,
+0x04d407,
+0x04e9b7,
+0x04f188,
+0x050d15,
+0x05152a,
+0x05289a,
+0x0530a5,
+0x054ff2,
+0x0557cd,
+0x056a7d,
+0x057242,
+0x058866,
+0x059059,
+0x05ade9,
+0x05b5d6,
+0x05ca81,
+0x05d2be,
+0x05ef0e,
+0x05f731,
+0x0608f1,
+0x0610ce,
+0x062d7e,
+0x063541,
+0x064a16,
+0x065229,
+0x066f99,
+0x0677a6,
+0x068d82,
+0x0695bd,
+0x06a80d,
+0x06b032,
+0x06cf65,
+0x06d75a,
+0x06eaea,
+0x06f2d5,
+0x070e48,
+0x071677,
+0x072bc7,
+0x0733f8,
+0x074caf,
+0x075490,
+0x076920,
+0x07711f,
+0x078b3b,
+0x079304,
+0x07aeb4,
+0x07b68b,
+0x07c9dc,
+0x07d1e3,
+0x07ec53,
+0x07f46c,
+0x0809d6,
+0x0811e9,
+0x082c59,
+0x083466,
+0x084b31,
+0x08530e,
+0x086ebe,
+0x087681,
+0x088ca5,
+0x08949a,
+0x08a92a,
+0x08b115,
+0x08ce42,
+0x08d67d,
+0x08ebcd,
+0x08f3f2,
+0x090f6f,
+0x091750,
+0x092ae0,
+0x0932df,
+0x094d88,
+0x0955b7,
+0x096807,
+0x097038,
+0x098a1c,
+0x099223,
+0x09af93,
+0x09b7ac,
+0x09c8fb,
+0x09d0c4,
+0x09ed74,
+0x09f54b,
+0x0a0a8b,
+0x0a12b4,
+0x0a2f04,
+0x0a373b,
+0x0a486c,
+0x0a5053,
+0x0a6de3,
+0x0a75dc,
+0x0a8ff8,
+0x0a97c7,
+0x0aaa77,
+0x0ab248,
+0x0acd1f,
+0x0ad520,
+0x0ae890,
+0x0af0af,
+0x0b0c32,
+0x0b140d,
+0x0b29bd,
+0x0b3182,
+0x0b4ed5,
+0x0b56ea,
+0x0b6b5a,
+0x0b7365,
+0x0b8941,
+0x0b917e,
+0x0bacce,
+0x0bb4f1,
+0x0bcba6,
+0x0bd399,
+0x0bee29,
+0x0bf616,
+0x0c027a,
+0x0c1a45,
+0x0c27f5,
+0x0c3fca,
+0x0c409d,
+0x0c58a2,
+0x0c6512,
+0x0c7d2d,
+0x0c8709,
+0x0c9f36,
+0x0ca286,
+0x0cbab9,
+0x0cc5ee,
+0x0cddd1,
+0x0ce061,
+0x0cf85e,
+0x0d04c3,
+0x0d1cfc,
+0x0d214c,
+0x0d3973,
+0x0d4624,
+0x0d5e1b,
+0x0d63ab,
+0x0d7b94,
+0x0d81b0,
+0x0d998f,
+0x0da43f,
+0x0dbc00,
+0x0dc357,
+0x0ddb68,
+0x0de6d8,
+0x0dfee7,
+0x0e0127,
+0x0e1918,
+0x0e24a8,
+0x0e3c97,
+0x0e43c0,
+0x0e5bff,
+0x0e664f,
+0x0e7e70,
+0x0e8454,
+0x0e9c6b,
+0x0ea1db,
+0x0eb9e4,
+0x0ec6b3,
+0x0ede8c,
+0x0ee33c,
+0x0efb03,
+0x0f079e,
+0x0f1fa1,
+0x0f2211,
+0x0f3a2e,
+0x0f4579,
+0x0f5d46,
+0x0f60f6,
+0x0f78c9,
+0x0f82ed,
+0x0f9ad2,
+0x0fa762,
+0x0fbf5d,
+0x0fc00a,
+0x0fd835,
+0x0fe585,
+0x0ffdba,
+0x100cea,
+0x1014d5,
+0x102965,
+0x10315a,
+0x104e0d,
+0x105632,
+0x106b82,
+0x1073bd,
+0x108999,
+0x1091a6,
+0x10ac16,
+0x10b429,
+0x10cb7e,
+0x10d341,
+0x10eef1,
+0x10f6ce,
+0x110a53,
+0x11126c,
+0x112fdc,
+0x1137e3,
+0x1148b4,
+0x11508b,
+0x116d3b,
+0x117504,
+0x118f20,
+0x11971f,
+0x11aaaf,
+0x11b290,
+0x11cdc7,
+0x11d5f8,
+0x11e848,
+0x11f077,
+0x120fb7,
+0x121788,
+0x122a38,
+0x123207,
+0x124d50,
+0x12556f,
+0x1268df,
+0x1270e0,
+0x128ac4,
+0x1292fb,
+0x12af4b,
+0x12b774,
+0x12c823,
+0x12d01c,
+0x12edac,
+0x12f593,
+0x13090e,
+0x131131,
+0x132c81,
+0x1334be,
+0x134be9,
+0x1353d6,
+0x136e66,
+0x137659,
+0x138c7d,
+0x139442,
+0x13a9f2,
+0x13b1cd,
+0x13ce9a,
+0x13d6a5,
+0x13eb15,
+0x13f32a,
+0x140746,
+0x141f79,
+0x1422c9,
+0x143af6,
+0x1445a1,
+0x145d9e,
+0x14602e,
+0x147811,
+0x148235,
+0x149a0a,
+0x14a7ba,
+0x14bf85,
+0x14c0d2,
+0x14d8ed,
+0x14e55d,
+0x14fd62,
+0x1501ff,
+0x1519c0,
+0x152470,
+0x153c4f,
+0x154318,
+0x155b27,
+0x156697,
+0x157ea8,
+0x15848c,
+0x159cb3,
+0x15a103,
+0x15b93c,
+0x15c66b,
+0x15de54,
+0x15e3e4,
+0x15fbdb,
+0x16041b,
+0x161c24,
+0x162194,
+0x1639ab,
+0x1646fc,
+0x165ec3,
+0x166373,
+0x167b4c,
+0x168168,
+0x169957,
+0x16a4e7,
+0x16bcd8,
+0x16c38f,
+0x16dbb0,
+0x16e600,
+0x16fe3f,
+0x1702a2,
+0x171a9d,
+0x17272d,
+0x173f12,
+0x174045,
+0x17587a,
+0x1765ca,
+0x177df5,
+0x1787d1,
+0x179fee,
+0x17a25e,
+0x17ba61,
+0x17c536,
+0x17dd09,
+0x17e0b9,
+0x17f886,
+0x18053c,
+0x181d03,
+0x1820b3,
+0x18388c,
+0x1847db,
+0x185fe4,
+0x186254,
+0x187a6b,
+0x18804f,
+0x189870,
+0x18a5c0,
+0x18bdff,
+0x18c2a8,
+0x18da97,
+0x18e727,
+0x18ff18,
+0x190385,
+0x191bba,
+0x19260a,
+0x193e35,
+0x194162,
+0x19595d,
+0x1964ed,
+0x197cd2,
+0x1986f6,
+0x199ec9,
+0x19a379,
+0x19bb46,
+0x19c411,
+0x19dc2e,
+0x19e19e,
+0x19f9a1,
+0x1a0661,
+0x1a1e5e,
+0x1a23ee,
+0x1a3bd1,
+0x1a4486,
+0x1a5cb9,
+0x1a6109,
+0x1a7936,
+0x1a8312,
+0x1a9b2d,
+0x1aa69d,
+0x1abea2,
+0x1ac1f5,
+0x1ad9ca,
+0x1ae47a,
+0x1afc45,
+0x1b00d8,
+0x1b18e7,
+0x1b2557,
+0x1b3d68,
+0x1b423f,
+0x1b5a00,
+0x1b67b0,
+0x1b7f8f,
+0x1b85ab,
+0x1b9d94,
+0x1ba024,
+0x1bb81b,
+0x1bc74c,
+0x1bdf73,
+0x1be2c3,
+0x1bfafc,
+0x1c0e90,
+0x1c16af,
+0x1c2b1f,
+0x1c3320,
+0x1c4c77,
+0x1c5448,
+0x1c69f8,
+0x1c71c7,
+0x1c8be3,
+0x1c93dc,
+0x1cae6c,
+0x1cb653,
+0x1cc904,
+0x1cd13b,
+0x1cec8b,
+0x1cf4b4,
+0x1d0829,
+0x1d1016,
+0x1d2da6,
+0x1d3599,
+0x1d4ace,
+0x1d52f1,
+0x1d6f41,
+0x1d777e,
+0x1d8d5a,
+0x1d9565,
+0x1da8d5,
+0x1db0ea,
+0x1dcfbd,
+0x1dd782,
+0x1dea32,
+0x1df20d,
+0x1e0dcd,
+0x1e15f2,
+0x1e2842,
+0x1e307d,
+0x1e4f2a,
+0x1e5715,
+0x1e6aa5,
+0x1e729a,
+0x1e88be,
+0x1e9081,
+0x1ead31,
+0x1eb50e,
+0x1eca59,
+0x1ed266,
+0x1eefd6,
+0x1ef7e9,
+0x1f0b74,
+0x1f134b,
+0x1f2efb,
+0x1f36c4,
+0x1f4993,
+0x1f51ac,
+0x1f6c1c,
+0x1f7423,
+0x1f8e07,
+0x1f9638,
+0x1fab88,
+0x1fb3b7,
+0x1fcce0,
+0x1fd4df,
+0x1fe96f,
+0x1ff150,
+0x200e74,
+0x20164b,
+0x202bfb,
+0x2033c4,
+0x204c93,
+0x2054ac,
+0x20691c,
+0x207123,
+0x208b07,
+0x209338,
+0x20ae88,
+0x20b6b7,
+0x20c9e0,
+0x20d1df,
+0x20ec6f,
+0x20f450,
+0x2108cd,
+0x2110f2,
+0x212d42,
+0x21357d,
+0x214a2a,
+0x215215,
+0x216fa5,
+0x21779a,
+0x218dbe,
+0x219581,
+0x21a831,
+0x21b00e,
+0x21cf59,
+0x21d766,
+0x21ead6,
+0x21f2e9,
+0x220d29,
+0x221516,
+0x2228a6,
+0x223099,
+0x224fce,
+0x2257f1,
+0x226a41,
+0x22727e,
+0x22885a,
+0x229065,
+0x22add5,
+0x22b5ea,
+0x22cabd,
+0x22d282,
+0x22ef32,
+0x22f70d,
+0x230b90,
+0x2313af,
+0x232e1f,
+0x233620,
+0x234977,
+0x235148,
+0x236cf8,
+0x2374c7,
+0x238ee3,
+0x2396dc,
+0x23ab6c,
+0x23b353,
+0x23cc04,
+0x23d43b,
+0x23e98b,
+0x23f1b4,
+0x2405d8,
+0x241de7,
+0x242057,
+0x243868,
+0x24473f,
+0x245f00,
+0x2462b0,
+0x247a8f,
+0x2480ab,
+0x249894,
+0x24a524,
+0x24bd1b,
+0x24c24c,
+0x24da73,
+0x24e7c3,
+0x24fffc,
+0x250361,
+0x251b5e,
+0x2526ee,
+0x253ed1,
+0x254186,
+0x2559b9,
+0x256409,
+0x257c36,
+0x258612,
+0x259e2d,
+0x25a39d,
+0x25bba2,
+0x25c4f5,
+0x25dcca,
+0x25e17a,
+0x25f945,
+0x260685,
+0x261eba,
+0x26230a,
+0x263b35,
+0x264462,
+0x265c5d,
+0x2661ed,
+0x2679d2,
+0x2683f6,
+0x269bc9,
+0x26a679,
+0x26be46,
+0x26c111,
+0x26d92e,
+0x26e49e,
+0x26fca1,
+0x27003c,
+0x271803,
+0x2725b3,
+0x273d8c,
+0x2742db,
+0x275ae4,
+0x276754,
+0x277f6b,
+0x27854f,
+0x279d70,
+0x27a0c0,
+0x27b8ff,
+0x27c7a8,
+0x27df97,
+0x27e227,
+0x27fa18,
+0x2807a2,
+0x281f9d,
+0x28222d,
+0x283a12,
+0x284545,
+0x285d7a,
+0x2860ca,
+0x2878f5,
+0x2882d1,
+0x289aee,
+0x28a75e,
+0x28bf61,
+0x28c036,
+0x28d809,
+0x28e5b9,
+0x28fd86,
+0x29011b,
+0x291924,
+0x292494,
+0x293cab,
+0x2943fc,
+0x295bc3,
+0x296673,
+0x297e4c,
+0x298468,
+0x299c57,
+0x29a1e7,
+0x29b9d8,
+0x29c68f,
+0x29deb0,
+0x29e300,
+0x29fb3f,
+0x2a04ff,
+0x2a1cc0,
+0x2a2170,
+0x2a394f,
+0x2a4618,
+0x2a5e27,
+0x2a6397,
+0x2a7ba8,
+0x2a818c,
+0x2a99b3,
+0x2aa403,
+0x2abc3c,
+0x2ac36b,
+0x2adb54,
+0x2ae6e4,
+0x2afedb,
+0x2b0246,
+0x2b1a79,
+0x2b27c9,
+0x2b3ff6,
+0x2b40a1,
+0x2b589e,
+0x2b652e,
+0x2b7d11,
+0x2b8735,
+0x2b9f0a,
+0x2ba2ba,
+0x2bba85,
+0x2bc5d2,
+0x2bdded,
+0x2be05d,
+0x2bf862,
+0x2c0c0e,
+0x2c1431,
+0x2c2981,
+0x2c31be,
+0x2c4ee9,
+0x2c56d6,
+0x2c6b66,
+0x2c7359,
+0x2c897d,
+0x2c9142,
+0x2cacf2,
+0x2cb4cd,
+0x2ccb9a,
+0x2cd3a5,
+0x2cee15,
+0x2cf62a,
+0x2d0ab7,
+0x2d1288,
+0x2d2f38,
+0x2d3707,
+0x2d4850,
+0x2d506f,
+0x2d6ddf,
+0x2d75e0,
+0x2d8fc4,
+0x2d97fb,
+0x2daa4b,
+0x2db274,
+0x2dcd23,
+0x2dd51c,
+0x2de8ac,
+0x2df093,
+0x2e0f53,
+0x2e176c,
+0x2e2adc,
+0x2e32e3,
+0x2e4db4,
+0x2e558b,
+0x2e683b,
+0x2e7004,
+0x2e8a20,
+0x2e921f,
+0x2eafaf,
+0x2eb790,
+0x2ec8c7,
+0x2ed0f8,
+0x2eed48,
+0x2ef577,
+0x2f09ea,
+0x2f11d5,
+0x2f2c65,
+0x2f345a,
+0x2f4b0d,
+0x2f5332,
+0x2f6e82,
+0x2f76bd,
+0x2f8c99,
+0x2f94a6,
+0x2fa916,
+0x2fb129,
+0x2fce7e,
+0x2fd641,
+0x2febf1,
+0x2ff3ce,
+0x30029e,
+0x301aa1,
+0x302711,
+0x303f2e,
+0x304079,
+0x305846,
+0x3065f6,
+0x307dc9,
+0x3087ed,
+0x309fd2,
+0x30a262,
+0x30ba5d,
+0x30c50a,
+0x30dd35,
+0x30e085,
+0x30f8ba,
+0x310427,
+0x311c18,
+0x3121a8,
+0x313997,
+0x3146c0,
+0x315eff,
+0x31634f,
+0x317b70,
+0x318154,
+0x31996b,
+0x31a4db,
+0x31bce4,
+0x31c3b3,
+0x31db8c,
+0x31e63c,
+0x31fe03,
+0x3201c3,
+0x3219fc,
+0x32244c,
+0x323c73,
+0x324324,
+0x325b1b,
+0x3266ab,
+0x327e94,
+0x3284b0,
+0x329c8f,
+0x32a13f,
+0x32b900,
+0x32c657,
+0x32de68,
+0x32e3d8,
+0x32fbe7,
+0x33077a,
+0x331f45,
+0x3322f5,
+0x333aca,
+0x33459d,
+0x335da2,
+0x336012,
+0x33782d,
+0x338209,
+0x339a36,
+0x33a786,
+0x33bfb9,
+0x33c0ee,
+0x33d8d1,
+0x33e561,
+0x33fd5e,
+0x340932,
+0x34110d,
+0x342cbd,
+0x343482,
+0x344bd5,
+0x3453ea,
+0x346e5a,
+0x347665,
+0x348c41,
+0x34947e,
+0x34a9ce,
+0x34b1f1,
+0x34cea6,
+0x34d699,
+0x34eb29,
+0x34f316,
+0x350f8b,
+0x3517b4,
+0x352a04,
+0x35323b,
+0x354d6c,
+0x355553,
+0x3568e3,
+0x3570dc,
+0x358af8,
+0x3592c7,
+0x35af77,
+0x35b748,
+0x35c81f,
+0x35d020,
+0x35ed90,
+0x35f5af,
+0x360a6f,
+0x361250,
+0x362fe0,
+0x3637df,
+0x364888,
+0x3650b7,
+0x366d07,
+0x367538,
+0x368f1c,
+0x369723,
+0x36aa93,
+0x36b2ac,
+0x36cdfb,
+0x36d5c4,
+0x36e874,
+0x36f04b,
+0x370cd6,
+0x3714e9,
+0x372959,
+0x373166,
+0x374e31,
+0x37560e,
+0x376bbe,
+0x377381,
+0x3789a5,
+0x37919a,
+0x37ac2a,
+0x37b415,
+0x37cb42,
+0x37d37d,
+0x37eecd,
+0x37f6f2,
+0x380b48,
+0x381377,
+0x382ec7,
+0x3836f8,
+0x3849af,
+0x385190,
+0x386c20,
+0x38741f,
+0x388e3b,
+0x389604,
+0x38abb4,
+0x38b38b,
+0x38ccdc,
+0x38d4e3,
+0x38e953,
+0x38f16c,
+0x390df1,
+0x3915ce,
+0x39287e,
+0x393041,
+0x394f16,
+0x395729,
+0x396a99,
+0x3972a6,
+0x398882,
+0x3990bd,
+0x39ad0d,
+0x39b532,
+0x39ca65,
+0x39d25a,
+0x39efea,
+0x39f7d5,
+0x3a0815,
+0x3a102a,
+0x3a2d9a,
+0x3a35a5,
+0x3a4af2,
+0x3a52cd,
+0x3a6f7d,
+0x3a7742,
+0x3a8d66,
+0x3a9559,
+0x3aa8e9,
+0x3ab0d6,
+0x3acf81,
+0x3ad7be,
+0x3aea0e,
+0x3af231,
+0x3b0eac,
+0x3b1693,
+0x3b2b23,
+0x3b331c,
+0x3b4c4b,
+0x3b5474,
+0x3b69c4,
+0x3b71fb,
+0x3b8bdf,
+0x3b93e0,
+0x3bae50,
+0x3bb66f,
+0x3bc938,
+0x3bd107,
+0x3becb7,
+0x3bf488,
+0x3c00e4,
+0x3c18db,
+0x3c256b,
+0x3c3d54,
+0x3c4203,
+0x3c5a3c,
+0x3c678c,
+0x3c7fb3,
+0x3c8597,
+0x3c9da8,
+0x3ca018,
+0x3cb827,
+0x3cc770,
+0x3cdf4f,
+0x3ce2ff,
+0x3cfac0,
+0x3d065d,
+0x3d1e62,
+0x3d23d2,
+0x3d3bed,
+0x3d44ba,
+0x3d5c85,
+0x3d6135,
+0x3d790a,
+0x3d832e,
+0x3d9b11,
+0x3da6a1,
+0x3dbe9e,
+0x3dc1c9,
+0x3dd9f6,
+0x3de446,
+0x3dfc79,
+0x3e03b9,
+0x3e1b86,
+0x3e2636,
+0x3e3e09,
+0x3e415e,
+0x3e5961,
+0x3e64d1,
+0x3e7cee,
+0x3e86ca,
+0x3e9ef5,
+0x3ea345,
+0x3ebb7a,
+0x3ec42d,
+0x3edc12,
+0x3ee1a2,
+0x3ef99d,
+0x3f0500,
+0x3f1d3f,
+0x3f208f,
+0x3f38b0,
+0x3f47e7,
+0x3f5fd8,
+0x3f6268,
+0x3f7a57,
+0x3f8073,
+0x3f984c,
+0x3fa5fc,
+0x3fbdc3,
+0x3fc294,
+0x3fdaab,
+0x3fe71b,
+0x3fff24,
+0x400f1a,
+0x401725,
+0x402a95,
+0x4032aa,
+0x404dfd,
+0x4055c2,
+0x406872,
+0x40704d,
+0x408a69,
+0x409256,
+0x40afe6,
+0x40b7d9,
+0x40c88e,
+0x40d0b1,
+0x40ed01,
+0x40f53e,
+0x4109a3,
+0x41119c,
+0x412c2c,
+0x413413,
+0x414b44,
+0x41537b,
+0x416ecb,
+0x4176f4,
+0x418cd0,
+0x4194ef,
+0x41a95f,
+0x41b160,
+0x41ce37,
+0x41d608,
+0x41ebb8,
+0x41f387,
+0x420c47,
+0x421478,
+0x4229c8,
+0x4231f7,
+0x424ea0,
+0x42569f,
+0x426b2f,
+0x427310,
+0x428934,
+0x42910b,
+0x42acbb,
+0x42b484,
+0x42cbd3,
+0x42d3ec,
+0x42ee5c,
+0x42f663,
+0x430afe,
+0x4312c1,
+0x432f71,
+0x43374e,
+0x434819,
+0x435026,
+0x436d96,
+0x4375a9,
+0x438f8d,
+0x4397b2,
+0x43aa02,
+0x43b23d,
+0x43cd6a,
+0x43d555,
+0x43e8e5,
+0x43f0da,
+0x4404b6,
+0x441c89,
+0x442139,
+0x443906,
+0x444651,
+0x445e6e,
+0x4463de,
+0x447be1,
+0x4481c5,
+0x4499fa,
+0x44a44a,
+0x44bc75,
+0x44c322,
+0x44db1d,
+0x44e6ad,
+0x44fe92,
+0x45020f,
+0x451a30,
+0x452780,
+0x453fbf,
+0x4540e8,
+0x4558d7,
+0x456567,
+0x457d58,
+0x45877c,
+0x459f43,
+0x45a2f3,
+0x45bacc,
+0x45c59b,
+0x45dda4,
+0x45e014,
+0x45f82b,
+0x4607eb,
+0x461fd4,
+0x462264,
+0x463a5b,
+0x46450c,
+0x465d33,
+0x466083,
+0x4678bc,
+0x468298,
+0x469aa7,
+0x46a717,
+0x46bf28,
+0x46c07f,
+0x46d840,
+0x46e5f0,
+0x46fdcf,
+0x470152,
+0x47196d,
+0x4724dd,
+0x473ce2,
+0x4743b5,
+0x475b8a,
+0x47663a,
+0x477e05,
+0x478421,
+0x479c1e,
+0x47a1ae,
+0x47b991,
+0x47c6c6,
+0x47def9,
+0x47e349,
+0x47fb76,
+0x4806cc,
+0x481ef3,
+0x482343,
+0x483b7c,
+0x48442b,
+0x485c14,
+0x4861a4,
+0x48799b,
+0x4883bf,
+0x489b80,
+0x48a630,
+0x48be0f,
+0x48c158,
+0x48d967,
+0x48e4d7,
+0x48fce8,
+0x490075,
+0x49184a,
+0x4925fa,
+0x493dc5,
+0x494292,
+0x495aad,
+0x49671d,
+0x497f22,
+0x498506,
+0x499d39,
+0x49a089,
+0x49b8b6,
+0x49c7e1,
+0x49dfde,
+0x49e26e,
+0x49fa51,
+0x4a0591,
+0x4a1dae,
+0x4a201e,
+0x4a3821,
+0x4a4776,
+0x4a5f49,
+0x4a62f9,
+0x4a7ac6,
+0x4a80e2,
+0x4a98dd,
+0x4aa56d,
+0x4abd52,
+0x4ac205,
+0x4ada3a,
+0x4ae78a,
+0x4affb5,
+0x4b0328,
+0x4b1b17,
+0x4b26a7,
+0x4b3e98,
+0x4b41cf,
+0x4b59f0,
+0x4b6440,
+0x4b7c7f,
+0x4b865b,
+0x4b9e64,
+0x4ba3d4,
+0x4bbbeb,
+0x4bc4bc,
+0x4bdc83,
+0x4be133,
+0x4bf90c,
+0x4c0d60,
+0x4c155f,
+0x4c28ef,
+0x4c30d0,
+0x4c4f87,
+0x4c57b8,
+0x4c6a08,
+0x4c7237,
+0x4c8813,
+0x4c902c,
+0x4cad9c,
+0x4cb5a3,
+0x4ccaf4,
+0x4cd2cb,
+0x4cef7b,
+0x4cf744,
+0x4d0bd9,
+0x4d13e6,
+0x4d2e56,
+0x4d3669,
+0x4d493e,
+0x4d5101,
+0x4d6cb1,
+0x4d748e,
+0x4d8eaa,
+0x4d9695,
+0x4dab25,
+0x4db31a,
+0x4dcc4d,
+0x4dd472,
+0x4de9c2,
+0x4df1fd,
+0x4e0e3d,
+0x4e1602,
+0x4e2bb2,
+0x4e338d,
+0x4e4cda,
+0x4e54e5,
+0x4e6955,
+0x4e716a,
+0x4e8b4e,
+0x4e9371,
+0x4eaec1,
+0x4eb6fe,
+0x4ec9a9,
+0x4ed196,
+0x4eec26,
+0x4ef419,
+0x4f0884,
+0x4f10bb,
+0x4f2d0b,
+0x4f3534,
+0x4f4a63,
+0x4f525c,
+0x4f6fec,
+0x4f77d3,
+0x4f8df7,
+0x4f95c8,
+0x4fa878,
+0x4fb047,
+0x4fcf10,
+0x4fd72f,
+0x4fea9f,
+0x4ff2a0,
+0x5003f0,
+0x501bcf,
+0x50267f,
+0x503e40,
+0x504117,
+0x505928,
+0x506498,
+0x507ca7,
+0x508683,
+0x509ebc,
+0x50a30c,
+0x50bb33,
+0x50c464,
+0x50dc5b,
+0x50e1eb,
+0x50f9d4,
+0x510549,
+0x511d76,
+0x5120c6,
+0x5138f9,
+0x5147ae,
+0x515f91,
+0x516221,
+0x517a1e,
+0x51803a,
+0x519805,
+0x51a5b5,
+0x51bd8a,
+0x51c2dd,
+0x51dae2,
+0x51e752,
+0x51ff6d,
+0x5200ad,
+0x521892,
+0x522522,
+0x523d1d,
+0x52424a,
+0x525a75,
+0x5267c5,
+0x527ffa,
+0x5285de,
+0x529de1,
+0x52a051,
+0x52b86e,
+0x52c739,
+0x52df06,
+0x52e2b6,
+0x52fa89,
+0x530614,
+0x531e2b,
+0x53239b,
+0x533ba4,
+0x5344f3,
+0x535ccc,
+0x53617c,
+0x537943,
+0x538367,
+0x539b58,
+0x53a6e8,
+0x53bed7,
+0x53c180,
+0x53d9bf,
+0x53e40f,
+0x53fc30,
+0x54085c,
+0x541063,
+0x542dd3,
+0x5435ec,
+0x544abb,
+0x545284,
+0x546f34,
+0x54770b,
+0x548d2f,
+0x549510,
+0x54a8a0,
+0x54b09f,
+0x54cfc8,
+0x54d7f7,
+0x54ea47,
+0x54f278,
+0x550ee5,
+0x5516da,
+0x552b6a,
+0x553355,
+0x554c02,
+0x55543d,
+0x55698d,
+0x5571b2,
+0x558b96,
+0x5593a9,
+0x55ae19,
+0x55b626,
+0x55c971,
+0x55d14e,
+0x55ecfe,
+0x55f4c1,
+0x560b01,
+0x56133e,
+0x562e8e,
+0x5636b1,
+0x5649e6,
+0x5651d9,
+0x566c69,
+0x567456,
+0x568e72,
+0x56964d,
+0x56abfd,
+0x56b3c2,
+0x56cc95,
+0x56d4aa,
+0x56e91a,
+0x56f125,
+0x570db8,
+0x571587,
+0x572837,
+0x573008,
+0x574f5f,
+0x575760,
+0x576ad0,
+0x5772ef,
+0x5788cb,
+0x5790f4,
+0x57ad44,
+0x57b57b,
+0x57ca2c,
+0x57d213,
+0x57efa3,
+0x57f79c,
+0x580a26,
+0x581219,
+0x582fa9,
+0x583796,
+0x5848c1,
+0x5850fe,
+0x586d4e,
+0x587571,
+0x588f55,
+0x58976a,
+0x58aada,
+0x58b2e5,
+0x58cdb2,
+0x58d58d,
+0x58e83d,
+0x58f002,
+0x590c9f,
+0x5914a0,
+0x592910,
+0x59312f,
+0x594e78,
+0x595647,
+0x596bf7,
+0x5973c8,
+0x5989ec,
+0x5991d3,
+0x59ac63,
+0x59b45c,
+0x59cb0b,
+0x59d334,
+0x59ee84,
+0x59f6bb,
+0x5a097b,
+0x5a1144,
+0x5a2cf4,
+0x5a34cb,
+0x5a4b9c,
+0x5a53a3,
+0x5a6e13,
+0x5a762c,
+0x5a8c08,
+0x5a9437,
+0x5aa987,
+0x5ab1b8,
+0x5aceef,
+0x5ad6d0,
+0x5aeb60,
+0x5af35f,
+0x5b0fc2,
+0x5b17fd,
+0x5b2a4d,
+0x5b3272,
+0x5b4d25,
+0x5b551a,
+0x5b68aa,
+0x5b7095,
+0x5b8ab1,
+0x5b928e,
+0x5baf3e,
+0x5bb701,
+0x5bc856,
+0x5bd069,
+0x5bedd9,
+0x5bf5e6,
+0x5c018a,
+0x5c19b5,
+0x5c2405,
+0x5c3c3a,
+0x5c436d,
+0x5c5b52,
+0x5c66e2,
+0x5c7edd,
+0x5c84f9,
+0x5c9cc6,
+0x5ca176,
+0x5cb949,
+0x5cc61e,
+0x5cde21,
+0x5ce391,
+0x5cfbae,
+0x5d0733,
+0x5d1f0c,
+0x5d22bc,
+0x5d3a83,
+0x5d45d4,
+0x5d5deb,
+0x5d605b,
+0x5d7864,
+0x5d8240,
+0x5d9a7f,
+0x5da7cf,
+0x5dbff0,
+0x5dc0a7,
+0x5dd898,
+0x5de528,
+0x5dfd17,
+0x5e02d7,
+0x5e1ae8,
+0x5e2758,
+0x5e3f67,
+0x5e4030,
+0x5e580f,
+0x5e65bf,
+0x5e7d80,
+0x5e87a4,
+0x5e9f9b,
+0x5ea22b,
+0x5eba14,
+0x5ec543,
+0x5edd7c,
+0x5ee0cc,
+0x5ef8f3,
+0x5f046e,
+0x5f1c51,
+0x5f21e1,
+0x5f39de,
+0x5f4689,
+0x5f5eb6,
+0x5f6306,
+0x5f7b39,
+0x5f811d,
+0x5f9922,
+0x5fa492,
+0x5fbcad,
+0x5fc3fa,
+0x5fdbc5,
+0x5fe675,
+0x5ffe4a,
+0x60016e,
+0x601951,
+0x6024e1,
+0x603cde,
+0x604389,
+0x605bb6,
+0x606606,
+0x607e39,
+0x60841d,
+0x609c22,
+0x60a192,
+0x60b9ad,
+0x60c6fa,
+0x60dec5,
+0x60e375,
+0x60fb4a,
+0x6107d7,
+0x611fe8,
+0x612258,
+0x613a67,
+0x614530,
+0x615d0f,
+0x6160bf,
+0x617880,
+0x6182a4,
+0x619a9b,
+0x61a72b,
+0x61bf14,
+0x61c043,
+0x61d87c,
+0x61e5cc,
+0x61fdf3,
+0x620233,
+0x621a0c,
+0x6227bc,
+0x623f83,
+0x6240d4,
+0x6258eb,
+0x62655b,
+0x627d64,
+0x628740,
+0x629f7f,
+0x62a2cf,
+0x62baf0,
+0x62c5a7,
+0x62dd98,
+0x62e028,
+0x62f817,
+0x63048a,
+0x631cb5,
+0x632105,
+0x63393a,
+0x63466d,
+0x635e52,
+0x6363e2,
+0x637bdd,
+0x6381f9,
+0x6399c6,
+0x63a476,
+0x63bc49,
+0x63c31e,
+0x63db21,
+0x63e691,
+0x63feae,
+0x640ac2,
+0x6412fd,
+0x642f4d,
+0x643772,
+0x644825,
+0x64501a,
+0x646daa,
+0x647595,
+0x648fb1,
+0x64978e,
+0x64aa3e,
+0x64b201,
+0x64cd56,
+0x64d569,
+0x64e8d9,
+0x64f0e6,
+0x650c7b,
+0x651444,
+0x6529f4,
+0x6531cb,
+0x654e9c,
+0x6556a3,
+0x656b13,
+0x65732c,
+0x658908,
+0x659137,
+0x65ac87,
+0x65b4b8,
+0x65cbef,
+0x65d3d0,
+0x65ee60,
+0x65f65f,
+0x66099f,
+0x6611a0,
+0x662c10,
+0x66342f,
+0x664b78,
+0x665347,
+0x666ef7,
+0x6676c8,
+0x668cec,
+0x6694d3,
+0x66a963,
+0x66b15c,
+0x66ce0b,
+0x66d634,
+0x66eb84,
+0x66f3bb,
+0x670f26,
+0x671719,
+0x672aa9,
+0x673296,
+0x674dc1,
+0x6755fe,
+0x67684e,
+0x677071,
+0x678a55,
+0x67926a,
+0x67afda,
+0x67b7e5,
+0x67c8b2,
+0x67d08d,
+0x67ed3d,
+0x67f502,
+0x6808b8,
+0x681087,
+0x682d37,
+0x683508,
+0x684a5f,
+0x685260,
+0x686fd0,
+0x6877ef,
+0x688dcb,
+0x6895f4,
+0x68a844,
+0x68b07b,
+0x68cf2c,
+0x68d713,
+0x68eaa3,
+0x68f29c,
+0x690e01,
+0x69163e,
+0x692b8e,
+0x6933b1,
+0x694ce6,
+0x6954d9,
+0x696969,
+0x697156,
+0x698b72,
+0x69934d,
+0x69aefd,
+0x69b6c2,
+0x69c995,
+0x69d1aa,
+0x69ec1a,
+0x69f425,
+0x6a0be5,
+0x6a13da,
+0x6a2e6a,
+0x6a3655,
+0x6a4902,
+0x6a513d,
+0x6a6c8d,
+0x6a74b2,
+0x6a8e96,
+0x6a96a9,
+0x6aab19,
+0x6ab326,
+0x6acc71,
+0x6ad44e,
+0x6ae9fe,
+0x6af1c1,
+0x6b0d5c,
+0x6b1563,
+0x6b28d3,
+0x6b30ec,
+0x6b4fbb,
+0x6b5784,
+0x6b6a34,
+0x6b720b,
+0x6b882f,
+0x6b9010,
+0x6bada0,
+0x6bb59f,
+0x6bcac8,
+0x6bd2f7,
+0x6bef47,
+0x6bf778,
+0x6c0314,
+0x6c1b2b,
+0x6c269b,
+0x6c3ea4,
+0x6c41f3,
+0x6c59cc,
+0x6c647c,
+0x6c7c43,
+0x6c8667,
+0x6c9e58,
+0x6ca3e8,
+0x6cbbd7,
+0x6cc480,
+0x6cdcbf,
+0x6ce10f,
+0x6cf930,
+0x6d05ad,
+0x6d1d92,
+0x6d2022,
+0x6d381d,
+0x6d474a,
+0x6d5f75,
+0x6d62c5,
+0x6d7afa,
+0x6d80de,
+0x6d98e1,
+0x6da551,
+0x6dbd6e,
+0x6dc239,
+0x6dda06,
+0x6de7b6,
+0x6dff89,
+0x6e0049,
+0x6e1876,
+0x6e25c6,
+0x6e3df9,
+0x6e42ae,
+0x6e5a91,
+0x6e6721,
+0x6e7f1e,
+0x6e853a,
+0x6e9d05,
+0x6ea0b5,
+0x6eb88a,
+0x6ec7dd,
+0x6edfe2,
+0x6ee252,
+0x6efa6d,
+0x6f06f0,
+0x6f1ecf,
+0x6f237f,
+0x6f3b40,
+0x6f4417,
+0x6f5c28,
+0x6f6198,
+0x6f79a7,
+0x6f8383,
+0x6f9bbc,
+0x6fa60c,
+0x6fbe33,
+0x6fc164,
+0x6fd95b,
+0x6fe4eb,
+0x6ffcd4,
+0x700d84,
+0x7015bb,
+0x70280b,
+0x703034,
+0x704f63,
+0x70575c,
+0x706aec,
+0x7072d3,
+0x7088f7,
+0x7090c8,
+0x70ad78,
+0x70b547,
+0x70ca10,
+0x70d22f,
+0x70ef9f,
+0x70f7a0,
+0x710b3d,
+0x711302,
+0x712eb2,
+0x71368d,
+0x7149da,
+0x7151e5,
+0x716c55,
+0x71746a,
+0x718e4e,
+0x719671,
+0x71abc1,
+0x71b3fe,
+0x71cca9,
+0x71d496,
+0x71e926,
+0x71f119,
+0x720ed9,
+0x7216e6,
+0x722b56,
+0x723369,
+0x724c3e,
+0x725401,
+0x7269b1,
+0x72718e,
+0x728baa,
+0x729395,
+0x72ae25,
+0x72b61a,
+0x72c94d,
+0x72d172,
+0x72ecc2,
+0x72f4fd,
+0x730860,
+0x73105f,
+0x732def,
+0x7335d0,
+0x734a87,
+0x7352b8,
+0x736f08,
+0x737737,
+0x738d13,
+0x73952c,
+0x73a89c,
+0x73b0a3,
+0x73cff4,
+0x73d7cb,
+0x73ea7b,
+0x73f244,
+0x740628,
+0x741e17,
+0x7423a7,
+0x743b98,
+0x7444cf,
+0x745cf0,
+0x746140,
+0x74797f,
+0x74835b,
+0x749b64,
+0x74a6d4,
+0x74beeb,
+0x74c1bc,
+0x74d983,
+0x74e433,
+0x74fc0c,
+0x750091,
+0x7518ae,
+0x75251e,
+0x753d21,
+0x754276,
+0x755a49,
+0x7567f9,
+0x757fc6,
+0x7585e2,
+0x759ddd,
+0x75a06d,
+0x75b852,
+0x75c705,
+0x75df3a,
+0x75e28a,
+0x75fab5,
+0x760575,
+0x761d4a,
+0x7620fa,
+0x7638c5,
+0x764792,
+0x765fad,
+0x76621d,
+0x767a22,
+0x768006,
+0x769839,
+0x76a589,
+0x76bdb6,
+0x76c2e1,
+0x76dade,
+0x76e76e,
+0x76ff51,
+0x7703cc,
+0x771bf3,
+0x772643,
+0x773e7c,
+0x77412b,
+0x775914,
+0x7764a4,
+0x777c9b,
+0x7786bf,
+0x779e80,
+0x77a330,
+0x77bb0f,
+0x77c458,
+0x77dc67,
+0x77e1d7,
+0x77f9e8,
+0x780452,
+0x781c6d,
+0x7821dd,
+0x7839e2,
+0x7846b5,
+0x785e8a,
+0x78633a,
+0x787b05,
+0x788121,
+0x78991e,
+0x78a4ae,
+0x78bc91,
+0x78c3c6,
+0x78dbf9,
+0x78e649,
+0x78fe76,
+0x7902eb,
+0x791ad4,
+0x792764,
+0x793f5b,
+0x79400c,
+0x795833,
+0x796583,
+0x797dbc,
+0x798798,
+0x799fa7,
+0x79a217,
+0x79ba28,
+0x79c57f,
+0x79dd40,
+0x79e0f0,
+0x79f8cf,
+0x7a070f,
+0x7a1f30,
+0x7a2280,
+0x7a3abf,
+0x7a45e8,
+0x7a5dd7,
+0x7a6067,
+0x7a7858,
+0x7a827c,
+0x7a9a43,
+0x7aa7f3,
+0x7abfcc,
+0x7ac09b,
+0x7ad8a4,
+0x7ae514,
+0x7afd2b,
+0x7b01b6,
+0x7b1989,
+0x7b2439,
+0x7b3c06,
+0x7b4351,
+0x7b5b6e,
+0x7b66de,
+0x7b7ee1,
+0x7b84c5,
+0x7b9cfa,
+0x7ba14a,
+0x7bb975,
+0x7bc622,
+0x7bde1d,
+0x7be3ad,
+0x7bfb92,
+0x7c0ffe,
+0x7c17c1,
+0x7c2a71,
+0x7c324e,
+0x7c4d19,
+0x7c5526,
+0x7c6896,
+0x7c70a9,
+0x7c8a8d,
+0x7c92b2,
+0x7caf02,
+0x7cb73d,
+0x7cc86a,
+0x7cd055,
+0x7cede5,
+0x7cf5da,
+0x7d0947,
+0x7d1178,
+0x7d2cc8,
+0x7d34f7,
+0x7d4ba0,
+0x7d539f,
+0x7d6e2f,
+0x7d7610,
+0x7d8c34,
+0x7d940b,
+0x7da9bb,
+0x7db184,
+0x7dced3,
+0x7dd6ec,
+0x7deb5c,
+0x7df363,
+0x7e0ca3,
+0x7e149c,
+0x7e292c,
+0x7e3113,
+0x7e4e44,
+0x7e567b,
+0x7e6bcb,
+0x7e73f4,
+0x7e89d0,
+0x7e91ef,
+0x7eac5f,
+0x7eb460,
+0x7ecb37,
+0x7ed308,
+0x7eeeb8,
+0x7ef687,
+0x7f0a1a,
+0x7f1225,
+0x7f2f95,
+0x7f37aa,
+0x7f48fd,
+0x7f50c2,
+0x7f6d72,
+0x7f754d,
+0x7f8f69,
+0x7f9756,
+0x7faae6,
+0x7fb2d9,
+0x7fcd8e,
+0x7fd5b1,
+0x7fe801,
+0x7ff03e,
+0x800fc1,
+0x8017fe,
+0x802a4e,
+0x803271,
+0x804d26,
+0x805519,
+0x8068a9,
+0x807096,
+0x808ab2,
+0x80928d,
+0x80af3d,
+0x80b702,
+0x80c855,
+0x80d06a,
+0x80edda,
+0x80f5e5,
+0x810978,
+0x811147,
+0x812cf7,
+0x8134c8,
+0x814b9f,
+0x8153a0,
+0x816e10,
+0x81762f,
+0x818c0b,
+0x819434,
+0x81a984,
+0x81b1bb,
+0x81ceec,
+0x81d6d3,
+0x81eb63,
+0x81f35c,
+0x820c9c,
+0x8214a3,
+0x822913,
+0x82312c,
+0x824e7b,
+0x825644,
+0x826bf4,
+0x8273cb,
+0x8289ef,
+0x8291d0,
+0x82ac60,
+0x82b45f,
+0x82cb08,
+0x82d337,
+0x82ee87,
+0x82f6b8,
+0x830a25,
+0x83121a,
+0x832faa,
+0x833795,
+0x8348c2,
+0x8350fd,
+0x836d4d,
+0x837572,
+0x838f56,
+0x839769,
+0x83aad9,
+0x83b2e6,
+0x83cdb1,
+0x83d58e,
+0x83e83e,
+0x83f001,
+0x84046d,
+0x841c52,
+0x8421e2,
+0x8439dd,
+0x84468a,
+0x845eb5,
+0x846305,
+0x847b3a,
+0x84811e,
+0x849921,
+0x84a491,
+0x84bcae,
+0x84c3f9,
+0x84dbc6,
+0x84e676,
+0x84fe49,
+0x8502d4,
+0x851aeb,
+0x85275b,
+0x853f64,
+0x854033,
+0x85580c,
+0x8565bc,
+0x857d83,
+0x8587a7,
+0x859f98,
+0x85a228,
+0x85ba17,
+0x85c540,
+0x85dd7f,
+0x85e0cf,
+0x85f8f0,
+0x860730,
+0x861f0f,
+0x8622bf,
+0x863a80,
+0x8645d7,
+0x865de8,
+0x866058,
+0x867867,
+0x868243,
+0x869a7c,
+0x86a7cc,
+0x86bff3,
+0x86c0a4,
+0x86d89b,
+0x86e52b,
+0x86fd14,
+0x870189,
+0x8719b6,
+0x872406,
+0x873c39,
+0x87436e,
+0x875b51,
+0x8766e1,
+0x877ede,
+0x8784fa,
+0x879cc5,
+0x87a175,
+0x87b94a,
+0x87c61d,
+0x87de22,
+0x87e392,
+0x87fbad,
+0x880617,
+0x881e28,
+0x882398,
+0x883ba7,
+0x8844f0,
+0x885ccf,
+0x88617f,
+0x887940,
+0x888364,
+0x889b5b,
+0x88a6eb,
+0x88bed4,
+0x88c183,
+0x88d9bc,
+0x88e40c,
+0x88fc33,
+0x8900ae,
+0x891891,
+0x892521,
+0x893d1e,
+0x894249,
+0x895a76,
+0x8967c6,
+0x897ff9,
+0x8985dd,
+0x899de2,
+0x89a052,
+0x89b86d,
+0x89c73a,
+0x89df05,
+0x89e2b5,
+0x89fa8a,
+0x8a054a,
+0x8a1d75,
+0x8a20c5,
+0x8a38fa,
+0x8a47ad,
+0x8a5f92,
+0x8a6222,
+0x8a7a1d,
+0x8a8039,
+0x8a9806,
+0x8aa5b6,
+0x8abd89,
+0x8ac2de,
+0x8adae1,
+0x8ae751,
+0x8aff6e,
+0x8b03f3,
+0x8b1bcc,
+0x8b267c,
+0x8b3e43,
+0x8b4114,
+0x8b592b,
+0x8b649b,
+0x8b7ca4,
+0x8b8680,
+0x8b9ebf,
+0x8ba30f,
+0x8bbb30,
+0x8bc467,
+0x8bdc58,
+0x8be1e8,
+0x8bf9d7,
+0x8c0dbb,
+0x8c1584,
+0x8c2834,
+0x8c300b,
+0x8c4f5c,
+0x8c5763,
+0x8c6ad3,
+0x8c72ec,
+0x8c88c8,
+0x8c90f7,
+0x8cad47,
+0x8cb578,
+0x8cca2f,
+0x8cd210,
+0x8cefa0,
+0x8cf79f,
+0x8d0b02,
+0x8d133d,
+0x8d2e8d,
+0x8d36b2,
+0x8d49e5,
+0x8d51da,
+0x8d6c6a,
+0x8d7455,
+0x8d8e71,
+0x8d964e,
+0x8dabfe,
+0x8db3c1,
+0x8dcc96,
+0x8dd4a9,
+0x8de919,
+0x8df126,
+0x8e0ee6,
+0x8e16d9,
+0x8e2b69,
+0x8e3356,
+0x8e4c01,
+0x8e543e,
+0x8e698e,
+0x8e71b1,
+0x8e8b95,
+0x8e93aa,
+0x8eae1a,
+0x8eb625,
+0x8ec972,
+0x8ed14d,
+0x8eecfd,
+0x8ef4c2,
+0x8f085f,
+0x8f1060,
+0x8f2dd0,
+0x8f35ef,
+0x8f4ab8,
+0x8f5287,
+0x8f6f37,
+0x8f7708,
+0x8f8d2c,
+0x8f9513,
+0x8fa8a3,
+0x8fb09c,
+0x8fcfcb,
+0x8fd7f4,
+0x8fea44,
+0x8ff27b,
+0x90032b,
+0x901b14,
+0x9026a4,
+0x903e9b,
+0x9041cc,
+0x9059f3,
+0x906443,
+0x907c7c,
+0x908658,
+0x909e67,
+0x90a3d7,
+0x90bbe8,
+0x90c4bf,
+0x90dc80,
+0x90e130,
+0x90f90f,
+0x910592,
+0x911dad,
+0x91201d,
+0x913822,
+0x914775,
+0x915f4a,
+0x9162fa,
+0x917ac5,
+0x9180e1,
+0x9198de,
+0x91a56e,
+0x91bd51,
+0x91c206,
+0x91da39,
+0x91e789,
+0x91ffb6,
+0x920076,
+0x921849,
+0x9225f9,
+0x923dc6,
+0x924291,
+0x925aae,
+0x92671e,
+0x927f21,
+0x928505,
+0x929d3a,
+0x92a08a,
+0x92b8b5,
+0x92c7e2,
+0x92dfdd,
+0x92e26d,
+0x92fa52,
+0x9306cf,
+0x931ef0,
+0x932340,
+0x933b7f,
+0x934428,
+0x935c17,
+0x9361a7,
+0x937998,
+0x9383bc,
+0x939b83,
+0x93a633,
+0x93be0c,
+0x93c15b,
+0x93d964,
+0x93e4d4,
+0x93fceb,
+0x940887,
+0x9410b8,
+0x942d08,
+0x943537,
+0x944a60,
+0x94525f,
+0x946fef,
+0x9477d0,
+0x948df4,
+0x9495cb,
+0x94a87b,
+0x94b044,
+0x94cf13,
+0x94d72c,
+0x94ea9c,
+0x94f2a3,
+0x950e3e,
+0x951601,
+0x952bb1,
+0x95338e,
+0x954cd9,
+0x9554e6,
+0x956956,
+0x957169,
+0x958b4d,
+0x959372,
+0x95aec2,
+0x95b6fd,
+0x95c9aa,
+0x95d195,
+0x95ec25,
+0x95f41a,
+0x960bda,
+0x9613e5,
+0x962e55,
+0x96366a,
+0x96493d,
+0x965102,
+0x966cb2,
+0x96748d,
+0x968ea9,
+0x969696,
+0x96ab26,
+0x96b319,
+0x96cc4e,
+0x96d471,
+0x96e9c1,
+0x96f1fe,
+0x970d63,
+0x97155c,
+0x9728ec,
+0x9730d3,
+0x974f84,
+0x9757bb,
+0x976a0b,
+0x977234,
+0x978810,
+0x97902f,
+0x97ad9f,
+0x97b5a0,
+0x97caf7,
+0x97d2c8,
+0x97ef78,
+0x97f747,
+0x980afd,
+0x9812c2,
+0x982f72,
+0x98374d,
+0x98481a,
+0x985025,
+0x986d95,
+0x9875aa,
+0x988f8e,
+0x9897b1,
+0x98aa01,
+0x98b23e,
+0x98cd69,
+0x98d556,
+0x98e8e6,
+0x98f0d9,
+0x990c44,
+0x99147b,
+0x9929cb,
+0x9931f4,
+0x994ea3,
+0x99569c,
+0x996b2c,
+0x997313,
+0x998937,
+0x999108,
+0x99acb8,
+0x99b487,
+0x99cbd0,
+0x99d3ef,
+0x99ee5f,
+0x99f660,
+0x9a09a0,
+0x9a119f,
+0x9a2c2f,
+0x9a3410,
+0x9a4b47,
+0x9a5378,
+0x9a6ec8,
+0x9a76f7,
+0x9a8cd3,
+0x9a94ec,
+0x9aa95c,
+0x9ab163,
+0x9ace34,
+0x9ad60b,
+0x9aebbb,
+0x9af384,
+0x9b0f19,
+0x9b1726,
+0x9b2a96,
+0x9b32a9,
+0x9b4dfe,
+0x9b55c1,
+0x9b6871,
+0x9b704e,
+0x9b8a6a,
+0x9b9255,
+0x9bafe5,
+0x9bb7da,
+0x9bc88d,
+0x9bd0b2,
+0x9bed02,
+0x9bf53d,
+0x9c0151,
+0x9c196e,
+0x9c24de,
+0x9c3ce1,
+0x9c43b6,
+0x9c5b89,
+0x9c6639,
+0x9c7e06,
+0x9c8422,
+0x9c9c1d,
+0x9ca1ad,
+0x9cb992,
+0x9cc6c5,
+0x9cdefa,
+0x9ce34a,
+0x9cfb75,
+0x9d07e8,
+0x9d1fd7,
+0x9d2267,
+0x9d3a58,
+0x9d450f,
+0x9d5d30,
+0x9d6080,
+0x9d78bf,
+0x9d829b,
+0x9d9aa4,
+0x9da714,
+0x9dbf2b,
+0x9dc07c,
+0x9dd843,
+0x9de5f3,
+0x9dfdcc,
+0x9e020c,
+0x9e1a33,
+0x9e2783,
+0x9e3fbc,
+0x9e40eb,
+0x9e58d4,
+0x9e6564,
+0x9e7d5b,
+0x9e877f,
+0x9e9f40,
+0x9ea2f0,
+0x9ebacf,
+0x9ec598,
+0x9edda7,
+0x9ee017,
+0x9ef828,
+0x9f04b5,
+0x9f1c8a,
+0x9f213a,
+0x9f3905,
+0x9f4652,
+0x9f5e6d,
+0x9f63dd,
+0x9f7be2,
+0x9f81c6,
+0x9f99f9,
+0x9fa449,
+0x9fbc76,
+0x9fc321,
+0x9fdb1e,
+0x9fe6ae,
+0x9ffe91,
+0xa001b5,
+0xa0198a,
+0xa0243a,
+0xa03c05,
+0xa04352,
+0xa05b6d,
+0xa066dd,
+0xa07ee2,
+0xa084c6,
+0xa09cf9,
+0xa0a149,
+0xa0b976,
+0xa0c621,
+0xa0de1e,
+0xa0e3ae,
+0xa0fb91,
+0xa1070c,
+0xa11f33,
+0xa12283,
+0xa13abc,
+0xa145eb,
+0xa15dd4,
+0xa16064,
+0xa1785b,
+0xa1827f,
+0xa19a40,
+0xa1a7f0,
+0xa1bfcf,
+0xa1c098,
+0xa1d8a7,
+0xa1e517,
+0xa1fd28,
+0xa202e8,
+0xa21ad7,
+0xa22767,
+0xa23f58,
+0xa2400f,
+0xa25830,
+0xa26580,
+0xa27dbf,
+0xa2879b,
+0xa29fa4,
+0xa2a214,
+0xa2ba2b,
+0xa2c57c,
+0xa2dd43,
+0xa2e0f3,
+0xa2f8cc,
+0xa30451,
+0xa31c6e,
+0xa321de,
+0xa339e1,
+0xa346b6,
+0xa35e89,
+0xa36339,
+0xa37b06,
+0xa38122,
+0xa3991d,
+0xa3a4ad,
+0xa3bc92,
+0xa3c3c5,
+0xa3dbfa,
+0xa3e64a,
+0xa3fe75,
+0xa40a19,
+0xa41226,
+0xa42f96,
+0xa437a9,
+0xa448fe,
+0xa450c1,
+0xa46d71,
+0xa4754e,
+0xa48f6a,
+0xa49755,
+0xa4aae5,
+0xa4b2da,
+0xa4cd8d,
+0xa4d5b2,
+0xa4e802,
+0xa4f03d,
+0xa50ca0,
+0xa5149f,
+0xa5292f,
+0xa53110,
+0xa54e47,
+0xa55678,
+0xa56bc8,
+0xa573f7,
+0xa589d3,
+0xa591ec,
+0xa5ac5c,
+0xa5b463,
+0xa5cb34,
+0xa5d30b,
+0xa5eebb,
+0xa5f684,
+0xa60944,
+0xa6117b,
+0xa62ccb,
+0xa634f4,
+0xa64ba3,
+0xa6539c,
+0xa66e2c,
+0xa67613,
+0xa68c37,
+0xa69408,
+0xa6a9b8,
+0xa6b187,
+0xa6ced0,
+0xa6d6ef,
+0xa6eb5f,
+0xa6f360,
+0xa70ffd,
+0xa717c2,
+0xa72a72,
+0xa7324d,
+0xa74d1a,
+0xa75525,
+0xa76895,
+0xa770aa,
+0xa78a8e,
+0xa792b1,
+0xa7af01,
+0xa7b73e,
+0xa7c869,
+0xa7d056,
+0xa7ede6,
+0xa7f5d9,
+0xa80863,
+0xa8105c,
+0xa82dec,
+0xa835d3,
+0xa84a84,
+0xa852bb,
+0xa86f0b,
+0xa87734,
+0xa88d10,
+0xa8952f,
+0xa8a89f,
+0xa8b0a0,
+0xa8cff7,
+0xa8d7c8,
+0xa8ea78,
+0xa8f247,
+0xa90eda,
+0xa916e5,
+0xa92b55,
+0xa9336a,
+0xa94c3d,
+0xa95402,
+0xa969b2,
+0xa9718d,
+0xa98ba9,
+0xa99396,
+0xa9ae26,
+0xa9b619,
+0xa9c94e,
+0xa9d171,
+0xa9ecc1,
+0xa9f4fe,
+0xaa0b3e,
+0xaa1301,
+0xaa2eb1,
+0xaa368e,
+0xaa49d9,
+0xaa51e6,
+0xaa6c56,
+0xaa7469,
+0xaa8e4d,
+0xaa9672,
+0xaaabc2,
+0xaab3fd,
+0xaaccaa,
+0xaad495,
+0xaae925,
+0xaaf11a,
+0xab0d87,
+0xab15b8,
+0xab2808,
+0xab3037,
+0xab4f60,
+0xab575f,
+0xab6aef,
+0xab72d0,
+0xab88f4,
+0xab90cb,
+0xabad7b,
+0xabb544,
+0xabca13,
+0xabd22c,
+0xabef9c,
+0xabf7a3,
+0xac03cf,
+0xac1bf0,
+0xac2640,
+0xac3e7f,
+0xac4128,
+0xac5917,
+0xac64a7,
+0xac7c98,
+0xac86bc,
+0xac9e83,
+0xaca333,
+0xacbb0c,
+0xacc45b,
+0xacdc64,
+0xace1d4,
+0xacf9eb,
+0xad0576,
+0xad1d49,
+0xad20f9,
+0xad38c6,
+0xad4791,
+0xad5fae,
+0xad621e,
+0xad7a21,
+0xad8005,
+0xad983a,
+0xada58a,
+0xadbdb5,
+0xadc2e2,
+0xaddadd,
+0xade76d,
+0xadff52,
+0xae0092,
+0xae18ad,
+0xae251d,
+0xae3d22,
+0xae4275,
+0xae5a4a,
+0xae67fa,
+0xae7fc5,
+0xae85e1,
+0xae9dde,
+0xaea06e,
+0xaeb851,
+0xaec706,
+0xaedf39,
+0xaee289,
+0xaefab6,
+0xaf062b,
+0xaf1e14,
+0xaf23a4,
+0xaf3b9b,
+0xaf44cc,
+0xaf5cf3,
+0xaf6143,
+0xaf797c,
+0xaf8358,
+0xaf9b67,
+0xafa6d7,
+0xafbee8,
+0xafc1bf,
+0xafd980,
+0xafe430,
+0xaffc0f,
+0xb00d5f,
+0xb01560,
+0xb028d0,
+0xb030ef,
+0xb04fb8,
+0xb05787,
+0xb06a37,
+0xb07208,
+0xb0882c,
+0xb09013,
+0xb0ada3,
+0xb0b59c,
+0xb0cacb,
+0xb0d2f4,
+0xb0ef44,
+0xb0f77b,
+0xb10be6,
+0xb113d9,
+0xb12e69,
+0xb13656,
+0xb14901,
+0xb1513e,
+0xb16c8e,
+0xb174b1,
+0xb18e95,
+0xb196aa,
+0xb1ab1a,
+0xb1b325,
+0xb1cc72,
+0xb1d44d,
+0xb1e9fd,
+0xb1f1c2,
+0xb20e02,
+0xb2163d,
+0xb22b8d,
+0xb233b2,
+0xb24ce5,
+0xb254da,
+0xb2696a,
+0xb27155,
+0xb28b71,
+0xb2934e,
+0xb2aefe,
+0xb2b6c1,
+0xb2c996,
+0xb2d1a9,
+0xb2ec19,
+0xb2f426,
+0xb308bb,
+0xb31084,
+0xb32d34,
+0xb3350b,
+0xb34a5c,
+0xb35263,
+0xb36fd3,
+0xb377ec,
+0xb38dc8,
+0xb395f7,
+0xb3a847,
+0xb3b078,
+0xb3cf2f,
+0xb3d710,
+0xb3eaa0,
+0xb3f29f,
+0xb406f3,
+0xb41ecc,
+0xb4237c,
+0xb43b43,
+0xb44414,
+0xb45c2b,
+0xb4619b,
+0xb479a4,
+0xb48380,
+0xb49bbf,
+0xb4a60f,
+0xb4be30,
+0xb4c167,
+0xb4d958,
+0xb4e4e8,
+0xb4fcd7,
+0xb5004a,
+0xb51875,
+0xb525c5,
+0xb53dfa,
+0xb542ad,
+0xb55a92,
+0xb56722,
+0xb57f1d,
+0xb58539,
+0xb59d06,
+0xb5a0b6,
+0xb5b889,
+0xb5c7de,
+0xb5dfe1,
+0xb5e251,
+0xb5fa6e,
+0xb605ae,
+0xb61d91,
+0xb62021,
+0xb6381e,
+0xb64749,
+0xb65f76,
+0xb662c6,
+0xb67af9,
+0xb680dd,
+0xb698e2,
+0xb6a552,
+0xb6bd6d,
+0xb6c23a,
+0xb6da05,
+0xb6e7b5,
+0xb6ff8a,
+0xb70317,
+0xb71b28,
+0xb72698,
+0xb73ea7,
+0xb741f0,
+0xb759cf,
+0xb7647f,
+0xb77c40,
+0xb78664,
+0xb79e5b,
+0xb7a3eb,
+0xb7bbd4,
+0xb7c483,
+0xb7dcbc,
+0xb7e10c,
+0xb7f933,
+0xb80489,
+0xb81cb6,
+0xb82106,
+0xb83939,
+0xb8466e,
+0xb85e51,
+0xb863e1,
+0xb87bde,
+0xb881fa,
+0xb899c5,
+0xb8a475,
+0xb8bc4a,
+0xb8c31d,
+0xb8db22,
+0xb8e692,
+0xb8fead,
+0xb90230,
+0xb91a0f,
+0xb927bf,
+0xb93f80,
+0xb940d7,
+0xb958e8,
+0xb96558,
+0xb97d67,
+0xb98743,
+0xb99f7c,
+0xb9a2cc,
+0xb9baf3,
+0xb9c5a4,
+0xb9dd9b,
+0xb9e02b,
+0xb9f814,
+0xba07d4,
+0xba1feb,
+0xba225b,
+0xba3a64,
+0xba4533,
+0xba5d0c,
+0xba60bc,
+0xba7883,
+0xba82a7,
+0xba9a98,
+0xbaa728,
+0xbabf17,
+0xbac040,
+0xbad87f,
+0xbae5cf,
+0xbafdf0,
+0xbb016d,
+0xbb1952,
+0xbb24e2,
+0xbb3cdd,
+0xbb438a,
+0xbb5bb5,
+0xbb6605,
+0xbb7e3a,
+0xbb841e,
+0xbb9c21,
+0xbba191,
+0xbbb9ae,
+0xbbc6f9,
+0xbbdec6,
+0xbbe376,
+0xbbfb49,
+0xbc0f25,
+0xbc171a,
+0xbc2aaa,
+0xbc3295,
+0xbc4dc2,
+0xbc55fd,
+0xbc684d,
+0xbc7072,
+0xbc8a56,
+0xbc9269,
+0xbcafd9,
+0xbcb7e6,
+0xbcc8b1,
+0xbcd08e,
+0xbced3e,
+0xbcf501,
+0xbd099c,
+0xbd11a3,
+0xbd2c13,
+0xbd342c,
+0xbd4b7b,
+0xbd5344,
+0xbd6ef4,
+0xbd76cb,
+0xbd8cef,
+0xbd94d0,
+0xbda960,
+0xbdb15f,
+0xbdce08,
+0xbdd637,
+0xbdeb87,
+0xbdf3b8,
+0xbe0c78,
+0xbe1447,
+0xbe29f7,
+0xbe31c8,
+0xbe4e9f,
+0xbe56a0,
+0xbe6b10,
+0xbe732f,
+0xbe890b,
+0xbe9134,
+0xbeac84,
+0xbeb4bb,
+0xbecbec,
+0xbed3d3,
+0xbeee63,
+0xbef65c,
+0xbf0ac1,
+0xbf12fe,
+0xbf2f4e,
+0xbf3771,
+0xbf4826,
+0xbf5019,
+0xbf6da9,
+0xbf7596,
+0xbf8fb2,
+0xbf978d,
+0xbfaa3d,
+0xbfb202,
+0xbfcd55,
+0xbfd56a,
+0xbfe8da,
+0xbff0e5,
+0xc000db,
+0xc018e4,
+0xc02554,
+0xc03d6b,
+0xc0423c,
+0xc05a03,
+0xc067b3,
+0xc07f8c,
+0xc085a8,
+0xc09d97,
+0xc0a027,
+0xc0b818,
+0xc0c74f,
+0xc0df70,
+0xc0e2c0,
+0xc0faff,
+0xc10662,
+0xc11e5d,
+0xc123ed,
+0xc13bd2,
+0xc14485,
+0xc15cba,
+0xc1610a,
+0xc17935,
+0xc18311,
+0xc19b2e,
+0xc1a69e,
+0xc1bea1,
+0xc1c1f6,
+0xc1d9c9,
+0xc1e479,
+0xc1fc46,
+0xc20386,
+0xc21bb9,
+0xc22609,
+0xc23e36,
+0xc24161,
+0xc2595e,
+0xc264ee,
+0xc27cd1,
+0xc286f5,
+0xc29eca,
+0xc2a37a,
+0xc2bb45,
+0xc2c412,
+0xc2dc2d,
+0xc2e19d,
+0xc2f9a2,
+0xc3053f,
+0xc31d00,
+0xc320b0,
+0xc3388f,
+0xc347d8,
+0xc35fe7,
+0xc36257,
+0xc37a68,
+0xc3804c,
+0xc39873,
+0xc3a5c3,
+0xc3bdfc,
+0xc3c2ab,
+0xc3da94,
+0xc3e724,
+0xc3ff1b,
+0xc40b77,
+0xc41348,
+0xc42ef8,
+0xc436c7,
+0xc44990,
+0xc451af,
+0xc46c1f,
+0xc47420,
+0xc48e04,
+0xc4963b,
+0xc4ab8b,
+0xc4b3b4,
+0xc4cce3,
+0xc4d4dc,
+0xc4e96c,
+0xc4f153,
+0xc50dce,
+0xc515f1,
+0xc52841,
+0xc5307e,
+0xc54f29,
+0xc55716,
+0xc56aa6,
+0xc57299,
+0xc588bd,
+0xc59082,
+0xc5ad32,
+0xc5b50d,
+0xc5ca5a,
+0xc5d265,
+0xc5efd5,
+0xc5f7ea,
+0xc6082a,
+0xc61015,
+0xc62da5,
+0xc6359a,
+0xc64acd,
+0xc652f2,
+0xc66f42,
+0xc6777d,
+0xc68d59,
+0xc69566,
+0xc6a8d6,
+0xc6b0e9,
+0xc6cfbe,
+0xc6d781,
+0xc6ea31,
+0xc6f20e,
+0xc70e93,
+0xc716ac,
+0xc72b1c,
+0xc73323,
+0xc74c74,
+0xc7544b,
+0xc769fb,
+0xc771c4,
+0xc78be0,
+0xc793df,
+0xc7ae6f,
+0xc7b650,
+0xc7c907,
+0xc7d138,
+0xc7ec88,
+0xc7f4b7,
+0xc8090d,
+0xc81132,
+0xc82c82,
+0xc834bd,
+0xc84bea,
+0xc853d5,
+0xc86e65,
+0xc8765a,
+0xc88c7e,
+0xc89441,
+0xc8a9f1,
+0xc8b1ce,
+0xc8ce99,
+0xc8d6a6,
+0xc8eb16,
+0xc8f329,
+0xc90fb4,
+0xc9178b,
+0xc92a3b,
+0xc93204,
+0xc94d53,
+0xc9556c,
+0xc968dc,
+0xc970e3,
+0xc98ac7,
+0xc992f8,
+0xc9af48,
+0xc9b777,
+0xc9c820,
+0xc9d01f,
+0xc9edaf,
+0xc9f590,
+0xca0a50,
+0xca126f,
+0xca2fdf,
+0xca37e0,
+0xca48b7,
+0xca5088,
+0xca6d38,
+0xca7507,
+0xca8f23,
+0xca971c,
+0xcaaaac,
+0xcab293,
+0xcacdc4,
+0xcad5fb,
+0xcae84b,
+0xcaf074,
+0xcb0ce9,
+0xcb14d6,
+0xcb2966,
+0xcb3159,
+0xcb4e0e,
+0xcb5631,
+0xcb6b81,
+0xcb73be,
+0xcb899a,
+0xcb91a5,
+0xcbac15,
+0xcbb42a,
+0xcbcb7d,
+0xcbd342,
+0xcbeef2,
+0xcbf6cd,
+0xcc02a1,
+0xcc1a9e,
+0xcc272e,
+0xcc3f11,
+0xcc4046,
+0xcc5879,
+0xcc65c9,
+0xcc7df6,
+0xcc87d2,
+0xcc9fed,
+0xcca25d,
+0xccba62,
+0xccc535,
+0xccdd0a,
+0xcce0ba,
+0xccf885,
+0xcd0418,
+0xcd1c27,
+0xcd2197,
+0xcd39a8,
+0xcd46ff,
+0xcd5ec0,
+0xcd6370,
+0xcd7b4f,
+0xcd816b,
+0xcd9954,
+0xcda4e4,
+0xcdbcdb,
+0xcdc38c,
+0xcddbb3,
+0xcde603,
+0xcdfe3c,
+0xce01fc,
+0xce19c3,
+0xce2473,
+0xce3c4c,
+0xce431b,
+0xce5b24,
+0xce6694,
+0xce7eab,
+0xce848f,
+0xce9cb0,
+0xcea100,
+0xceb93f,
+0xcec668,
+0xcede57,
+0xcee3e7,
+0xcefbd8,
+0xcf0745,
+0xcf1f7a,
+0xcf22ca,
+0xcf3af5,
+0xcf45a2,
+0xcf5d9d,
+0xcf602d,
+0xcf7812,
+0xcf8236,
+0xcf9a09,
+0xcfa7b9,
+0xcfbf86,
+0xcfc0d1,
+0xcfd8ee,
+0xcfe55e,
+0xcffd61,
+0xd00c31,
+0xd0140e,
+0xd029be,
+0xd03181,
+0xd04ed6,
+0xd056e9,
+0xd06b59,
+0xd07366,
+0xd08942,
+0xd0917d,
+0xd0accd,
+0xd0b4f2,
+0xd0cba5,
+0xd0d39a,
+0xd0ee2a,
+0xd0f615,
+0xd10a88,
+0xd112b7,
+0xd12f07,
+0xd13738,
+0xd1486f,
+0xd15050,
+0xd16de0,
+0xd175df,
+0xd18ffb,
+0xd197c4,
+0xd1aa74,
+0xd1b24b,
+0xd1cd1c,
+0xd1d523,
+0xd1e893,
+0xd1f0ac,
+0xd20f6c,
+0xd21753,
+0xd22ae3,
+0xd232dc,
+0xd24d8b,
+0xd255b4,
+0xd26804,
+0xd2703b,
+0xd28a1f,
+0xd29220,
+0xd2af90,
+0xd2b7af,
+0xd2c8f8,
+0xd2d0c7,
+0xd2ed77,
+0xd2f548,
+0xd309d5,
+0xd311ea,
+0xd32c5a,
+0xd33465,
+0xd34b32,
+0xd3530d,
+0xd36ebd,
+0xd37682,
+0xd38ca6,
+0xd39499,
+0xd3a929,
+0xd3b116,
+0xd3ce41,
+0xd3d67e,
+0xd3ebce,
+0xd3f3f1,
+0xd4079d,
+0xd41fa2,
+0xd42212,
+0xd43a2d,
+0xd4457a,
+0xd45d45,
+0xd460f5,
+0xd478ca,
+0xd482ee,
+0xd49ad1,
+0xd4a761,
+0xd4bf5e,
+0xd4c009,
+0xd4d836,
+0xd4e586,
+0xd4fdb9,
+0xd50124,
+0xd5191b,
+0xd524ab,
+0xd53c94,
+0xd543c3,
+0xd55bfc,
+0xd5664c,
+0xd57e73,
+0xd58457,
+0xd59c68,
+0xd5a1d8,
+0xd5b9e7,
+0xd5c6b0,
+0xd5de8f,
+0xd5e33f,
+0xd5fb00,
+0xd604c0,
+0xd61cff,
+0xd6214f,
+0xd63970,
+0xd64627,
+0xd65e18,
+0xd663a8,
+0xd67b97,
+0xd681b3,
+0xd6998c,
+0xd6a43c,
+0xd6bc03,
+0xd6c354,
+0xd6db6b,
+0xd6e6db,
+0xd6fee4,
+0xd70279,
+0xd71a46,
+0xd727f6,
+0xd73fc9,
+0xd7409e,
+0xd758a1,
+0xd76511,
+0xd77d2e,
+0xd7870a,
+0xd79f35,
+0xd7a285,
+0xd7baba,
+0xd7c5ed,
+0xd7ddd2,
+0xd7e062,
+0xd7f85d,
+0xd805e7,
+0xd81dd8,
+0xd82068,
+0xd83857,
+0xd84700,
+0xd85f3f,
+0xd8628f,
+0xd87ab0,
+0xd88094,
+0xd898ab,
+0xd8a51b,
+0xd8bd24,
+0xd8c273,
+0xd8da4c,
+0xd8e7fc,
+0xd8ffc3,
+0xd9035e,
+0xd91b61,
+0xd926d1,
+0xd93eee,
+0xd941b9,
+0xd95986,
+0xd96436,
+0xd97c09,
+0xd9862d,
+0xd99e12,
+0xd9a3a2,
+0xd9bb9d,
+0xd9c4ca,
+0xd9dcf5,
+0xd9e145,
+0xd9f97a,
+0xda06ba,
+0xda1e85,
+0xda2335,
+0xda3b0a,
+0xda445d,
+0xda5c62,
+0xda61d2,
+0xda79ed,
+0xda83c9,
+0xda9bf6,
+0xdaa646,
+0xdabe79,
+0xdac12e,
+0xdad911,
+0xdae4a1,
+0xdafc9e,
+0xdb0003,
+0xdb183c,
+0xdb258c,
+0xdb3db3,
+0xdb42e4,
+0xdb5adb,
+0xdb676b,
+0xdb7f54,
+0xdb8570,
+0xdb9d4f,
+0xdba0ff,
+0xdbb8c0,
+0xdbc797,
+0xdbdfa8,
+0xdbe218,
+0xdbfa27,
+0xdc0e4b,
+0xdc1674,
+0xdc2bc4,
+0xdc33fb,
+0xdc4cac,
+0xdc5493,
+0xdc6923,
+0xdc711c,
+0xdc8b38,
+0xdc9307,
+0xdcaeb7,
+0xdcb688,
+0xdcc9df,
+0xdcd1e0,
+0xdcec50,
+0xdcf46f,
+0xdd08f2,
+0xdd10cd,
+0xdd2d7d,
+0xdd3542,
+0xdd4a15,
+0xdd522a,
+0xdd6f9a,
+0xdd77a5,
+0xdd8d81,
+0xdd95be,
+0xdda80e,
+0xddb031,
+0xddcf66,
+0xddd759,
+0xddeae9,
+0xddf2d6,
+0xde0d16,
+0xde1529,
+0xde2899,
+0xde30a6,
+0xde4ff1,
+0xde57ce,
+0xde6a7e,
+0xde7241,
+0xde8865,
+0xde905a,
+0xdeadea,
+0xdeb5d5,
+0xdeca82,
+0xded2bd,
+0xdeef0d,
+0xdef732,
+0xdf0baf,
+0xdf1390,
+0xdf2e20,
+0xdf361f,
+0xdf4948,
+0xdf5177,
+0xdf6cc7,
+0xdf74f8,
+0xdf8edc,
+0xdf96e3,
+0xdfab53,
+0xdfb36c,
+0xdfcc3b,
+0xdfd404,
+0xdfe9b4,
+0xdff18b,
+0xe00eaf,
+0xe01690,
+0xe02b20,
+0xe0331f,
+0xe04c48,
+0xe05477,
+0xe069c7,
+0xe071f8,
+0xe08bdc,
+0xe093e3,
+0xe0ae53,
+0xe0b66c,
+0xe0c93b,
+0xe0d104,
+0xe0ecb4,
+0xe0f48b,
+0xe10816,
+0xe11029,
+0xe12d99,
+0xe135a6,
+0xe14af1,
+0xe152ce,
+0xe16f7e,
+0xe17741,
+0xe18d65,
+0xe1955a,
+0xe1a8ea,
+0xe1b0d5,
+0xe1cf82,
+0xe1d7bd,
+0xe1ea0d,
+0xe1f232,
+0xe20df2,
+0xe215cd,
+0xe2287d,
+0xe23042,
+0xe24f15,
+0xe2572a,
+0xe26a9a,
+0xe272a5,
+0xe28881,
+0xe290be,
+0xe2ad0e,
+0xe2b531,
+0xe2ca66,
+0xe2d259,
+0xe2efe9,
+0xe2f7d6,
+0xe30b4b,
+0xe31374,
+0xe32ec4,
+0xe336fb,
+0xe349ac,
+0xe35193,
+0xe36c23,
+0xe3741c,
+0xe38e38,
+0xe39607,
+0xe3abb7,
+0xe3b388,
+0xe3ccdf,
+0xe3d4e0,
+0xe3e950,
+0xe3f16f,
+0xe40503,
+0xe41d3c,
+0xe4208c,
+0xe438b3,
+0xe447e4,
+0xe45fdb,
+0xe4626b,
+0xe47a54,
+0xe48070,
+0xe4984f,
+0xe4a5ff,
+0xe4bdc0,
+0xe4c297,
+0xe4daa8,
+0xe4e718,
+0xe4ff27,
+0xe503ba,
+0xe51b85,
+0xe52635,
+0xe53e0a,
+0xe5415d,
+0xe55962,
+0xe564d2,
+0xe57ced,
+0xe586c9,
+0xe59ef6,
+0xe5a346,
+0xe5bb79,
+0xe5c42e,
+0xe5dc11,
+0xe5e1a1,
+0xe5f99e,
+0xe6065e,
+0xe61e61,
+0xe623d1,
+0xe63bee,
+0xe644b9,
+0xe65c86,
+0xe66136,
+0xe67909,
+0xe6832d,
+0xe69b12,
+0xe6a6a2,
+0xe6be9d,
+0xe6c1ca,
+0xe6d9f5,
+0xe6e445,
+0xe6fc7a,
+0xe700e7,
+0xe718d8,
+0xe72568,
+0xe73d57,
+0xe74200,
+0xe75a3f,
+0xe7678f,
+0xe77fb0,
+0xe78594,
+0xe79dab,
+0xe7a01b,
+0xe7b824,
+0xe7c773,
+0xe7df4c,
+0xe7e2fc,
+0xe7fac3,
+0xe80779,
+0xe81f46,
+0xe822f6,
+0xe83ac9,
+0xe8459e,
+0xe85da1,
+0xe86011,
+0xe8782e,
+0xe8820a,
+0xe89a35,
+0xe8a785,
+0xe8bfba,
+0xe8c0ed,
+0xe8d8d2,
+0xe8e562,
+0xe8fd5d,
+0xe901c0,
+0xe919ff,
+0xe9244f,
+0xe93c70,
+0xe94327,
+0xe95b18,
+0xe966a8,
+0xe97e97,
+0xe984b3,
+0xe99c8c,
+0xe9a13c,
+0xe9b903,
+0xe9c654,
+0xe9de6b,
+0xe9e3db,
+0xe9fbe4,
+0xea0424,
+0xea1c1b,
+0xea21ab,
+0xea3994,
+0xea46c3,
+0xea5efc,
+0xea634c,
+0xea7b73,
+0xea8157,
+0xea9968,
+0xeaa4d8,
+0xeabce7,
+0xeac3b0,
+0xeadb8f,
+0xeae63f,
+0xeafe00,
+0xeb029d,
+0xeb1aa2,
+0xeb2712,
+0xeb3f2d,
+0xeb407a,
+0xeb5845,
+0xeb65f5,
+0xeb7dca,
+0xeb87ee,
+0xeb9fd1,
+0xeba261,
+0xebba5e,
+0xebc509,
+0xebdd36,
+0xebe086,
+0xebf8b9,
+0xec0cd5,
+0xec14ea,
+0xec295a,
+0xec3165,
+0xec4e32,
+0xec560d,
+0xec6bbd,
+0xec7382,
+0xec89a6,
+0xec9199,
+0xecac29,
+0xecb416,
+0xeccb41,
+0xecd37e,
+0xeceece,
+0xecf6f1,
+0xed0a6c,
+0xed1253,
+0xed2fe3,
+0xed37dc,
+0xed488b,
+0xed50b4,
+0xed6d04,
+0xed753b,
+0xed8f1f,
+0xed9720,
+0xedaa90,
+0xedb2af,
+0xedcdf8,
+0xedd5c7,
+0xede877,
+0xedf048,
+0xee0f88,
+0xee17b7,
+0xee2a07,
+0xee3238,
+0xee4d6f,
+0xee5550,
+0xee68e0,
+0xee70df,
+0xee8afb,
+0xee92c4,
+0xeeaf74,
+0xeeb74b,
+0xeec81c,
+0xeed023,
+0xeeed93,
+0xeef5ac,
+0xef0931,
+0xef110e,
+0xef2cbe,
+0xef3481,
+0xef4bd6,
+0xef53e9,
+0xef6e59,
+0xef7666,
+0xef8c42,
+0xef947d,
+0xefa9cd,
+0xefb1f2,
+0xefcea5,
+0xefd69a,
+0xefeb2a,
+0xeff315,
+0xf00245,
+0xf01a7a,
+0xf027ca,
+0xf03ff5,
+0xf040a2,
+0xf0589d,
+0xf0652d,
+0xf07d12,
+0xf08736,
+0xf09f09,
+0xf0a2b9,
+0xf0ba86,
+0xf0c5d1,
+0xf0ddee,
+0xf0e05e,
+0xf0f861,
+0xf104fc,
+0xf11cc3,
+0xf12173,
+0xf1394c,
+0xf1461b,
+0xf15e24,
+0xf16394,
+0xf17bab,
+0xf1818f,
+0xf199b0,
+0xf1a400,
+0xf1bc3f,
+0xf1c368,
+0xf1db57,
+0xf1e6e7,
+0xf1fed8,
+0xf20118,
+0xf21927,
+0xf22497,
+0xf23ca8,
+0xf243ff,
+0xf25bc0,
+0xf26670,
+0xf27e4f,
+0xf2846b,
+0xf29c54,
+0xf2a1e4,
+0xf2b9db,
+0xf2c68c,
+0xf2deb3,
+0xf2e303,
+0xf2fb3c,
+0xf307a1,
+0xf31f9e,
+0xf3222e,
+0xf33a11,
+0xf34546,
+0xf35d79,
+0xf360c9,
+0xf378f6,
+0xf382d2,
+0xf39aed,
+0xf3a75d,
+0xf3bf62,
+0xf3c035,
+0xf3d80a,
+0xf3e5ba,
+0xf3fd85,
+0xf409e9,
+0xf411d6,
+0xf42c66,
+0xf43459,
+0xf44b0e,
+0xf45331,
+0xf46e81,
+0xf476be,
+0xf48c9a,
+0xf494a5,
+0xf4a915,
+0xf4b12a,
+0xf4ce7d,
+0xf4d642,
+0xf4ebf2,
+0xf4f3cd,
+0xf50f50,
+0xf5176f,
+0xf52adf,
+0xf532e0,
+0xf54db7,
+0xf55588,
+0xf56838,
+0xf57007,
+0xf58a23,
+0xf5921c,
+0xf5afac,
+0xf5b793,
+0xf5c8c4,
+0xf5d0fb,
+0xf5ed4b,
+0xf5f574,
+0xf60ab4,
+0xf6128b,
+0xf62f3b,
+0xf63704,
+0xf64853,
+0xf6506c,
+0xf66ddc,
+0xf675e3,
+0xf68fc7,
+0xf697f8,
+0xf6aa48,
+0xf6b277,
+0xf6cd20,
+0xf6d51f,
+0xf6e8af,
+0xf6f090,
+0xf70c0d,
+0xf71432,
+0xf72982,
+0xf731bd,
+0xf74eea,
+0xf756d5,
+0xf76b65,
+0xf7735a,
+0xf7897e,
+0xf79141,
+0xf7acf1,
+0xf7b4ce,
+0xf7cb99,
+0xf7d3a6,
+0xf7ee16,
+0xf7f629,
+0xf80b93,
+0xf813ac,
+0xf82e1c,
+0xf83623,
+0xf84974,
+0xf8514b,
+0xf86cfb,
+0xf874c4,
+0xf88ee0,
+0xf896df,
+0xf8ab6f,
+0xf8b350,
+0xf8cc07,
+0xf8d438,
+0xf8e988,
+0xf8f1b7,
+0xf90d2a,
+0xf91515,
+0xf928a5,
+0xf9309a,
+0xf94fcd,
+0xf957f2,
+0xf96a42,
+0xf9727d,
+0xf98859,
+0xf99066,
+0xf9add6,
+0xf9b5e9,
+0xf9cabe,
+0xf9d281,
+0xf9ef31,
+0xf9f70e,
+0xfa08ce,
+0xfa10f1,
+0xfa2d41,
+0xfa357e,
+0xfa4a29,
+0xfa5216,
+0xfa6fa6,
+0xfa7799,
+0xfa8dbd,
+0xfa9582,
+0xfaa832,
+0xfab00d,
+0xfacf5a,
+0xfad765,
+0xfaead5,
+0xfaf2ea,
+0xfb0e77,
+0xfb1648,
+0xfb2bf8,
+0xfb33c7,
+0xfb4c90,
+0xfb54af,
+0xfb691f,
+0xfb7120,
+0xfb8b04,
+0xfb933b,
+0xfbae8b,
+0xfbb6b4,
+0xfbc9e3,
+0xfbd1dc,
+0xfbec6c,
+0xfbf453,
+0xfc003f,
+0xfc1800,
+0xfc25b0,
+0xfc3d8f,
+0xfc42d8,
+0xfc5ae7,
+0xfc6757,
+0xfc7f68,
+0xfc854c,
+0xfc9d73,
+0xfca0c3,
+0xfcb8fc,
+0xfcc7ab,
+0xfcdf94,
+0xfce224,
+0xfcfa1b,
+0xfd0686,
+0xfd1eb9,
+0xfd2309,
+0xfd3b36,
+0xfd4461,
+0xfd5c5e,
+0xfd61ee,
+0xfd79d1,
+0xfd83f5,
+0xfd9bca,
+0xfda67a,
+0xfdbe45,
+0xfdc112,
+0xfdd92d,
+0xfde49d,
+0xfdfca2,
+0xfe0362,
+0xfe1b5d,
+0xfe26ed,
+0xfe3ed2,
+0xfe4185,
+0xfe59ba,
+0xfe640a,
+0xfe7c35,
+0xfe8611,
+0xfe9e2e,
+0xfea39e,
+0xfebba1,
+0xfec4f6,
+0xfedcc9,
+0xfee179,
+0xfef946,
+0xff05db,
+0xff1de4,
+0xff2054,
+0xff386b,
+0xff473c,
+0xff5f03,
+0xff62b3,
+0xff7a8c,
+0xff80a8,
+0xff9897,
+0xffa527,
+0xffbd18,
+0xffc24f,
+0xffda70,
+0xffe7c0,
+0xffffff
+};
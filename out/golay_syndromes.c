@@ -0,0 +1,4098 @@
+unsigned long golay_syndromes[4096]={
+0x000000,
+0x000001,
+0x000002,
+0x000003,
+0x000004,
+0x000005,
+0x000006,
+0x000007,
+0x000008,
+0x000009,
+0x00000a,
+0x00000b,
+0x00000c,
+0x00000d,
+0x00000e,
+0xffffffff,
+0x000010,
+0x000011,
+0x000012,
+0x000013,
+0x000014,
+0x000015,
+0x000016,
+0xffffffff,
+0x000018,
+0x000019,
+0x00001a,
+0xffffffff,
+0x00001c,
+0xffffffff,
+0xffffffff,
+0x001820,
+0x000020,
+0x000021,
+0x000022,
+0x000023,
+0x000024,
+0x000025,
+0x000026,
+0xffffffff,
+0x000028,
+0x000029,
+0x00002a,
+0xffffffff,
+0x00002c,
+0xffffffff,
+0xffffffff,
+0x001810,
+0x000030,
+0x000031,
+0x000032,
+0xffffffff,
+0x000034,
+0xffffffff,
+0xffffffff,
+0x001808,
+0x000038,
+0xffffffff,
+0xffffffff,
+0x001804,
+0xffffffff,
+0x001802,
+0x001801,
+0x001800,
+0x000040,
+0x000041,
+0x000042,
+0x000043,
+0x000044,
+0x000045,
+0x000046,
+0xffffffff,
+0x000048,
+0x000049,
+0x00004a,
+0xffffffff,
+0x00004c,
+0xffffffff,
+0xffffffff,
+0x188000,
+0x000050,
+0x000051,
+0x000052,
+0xffffffff,
+0x000054,
+0xffffffff,
+0xffffffff,
+0x242000,
+0x000058,
+0xffffffff,
+0xffffffff,
+0xc00080,
+0xffffffff,
+0x020300,
+0x014400,
+0xffffffff,
+0x000060,
+0x000061,
+0x000062,
+0xffffffff,
+0x000064,
+0xffffffff,
+0xffffffff,
+0x004280,
+0x000068,
+0xffffffff,
+0xffffffff,
+0x032000,
+0xffffffff,
+0x840400,
+0x600100,
+0xffffffff,
+0x000070,
+0xffffffff,
+0xffffffff,
+0x008500,
+0xffffffff,
+0x490000,
+0x920000,
+0xffffffff,
+0xffffffff,
+0x304000,
+0x0c0200,
+0xffffffff,
+0x00a080,
+0xffffffff,
+0xffffffff,
+0x001840,
+0x000080,
+0x000081,
+0x000082,
+0x000083,
+0x000084,
+0x000085,
+0x000086,
+0xffffffff,
+0x000088,
+0x000089,
+0x00008a,
+0xffffffff,
+0x00008c,
+0xffffffff,
+0xffffffff,
+0x002500,
+0x000090,
+0x000091,
+0x000092,
+0xffffffff,
+0x000094,
+0xffffffff,
+0xffffffff,
+0x038000,
+0x000098,
+0xffffffff,
+0xffffffff,
+0xc00040,
+0xffffffff,
+0x0c4000,
+0x300200,
+0xffffffff,
+0x0000a0,
+0x0000a1,
+0x0000a2,
+0xffffffff,
+0x0000a4,
+0xffffffff,
+0xffffffff,
+0x004240,
+0x0000a8,
+0xffffffff,
+0xffffffff,
+0x248000,
+0xffffffff,
+0x520000,
+0x890000,
+0xffffffff,
+0x0000b0,
+0xffffffff,
+0xffffffff,
+0x182000,
+0xffffffff,
+0xa00100,
+0x440400,
+0xffffffff,
+0xffffffff,
+0x010600,
+0x024100,
+0xffffffff,
+0x00a040,
+0xffffffff,
+0xffffffff,
+0x001880,
+0x0000c0,
+0x0000c1,
+0x0000c2,
+0xffffffff,
+0x0000c4,
+0xffffffff,
+0xffffffff,
+0x004220,
+0x0000c8,
+0xffffffff,
+0xffffffff,
+0xc00010,
+0xffffffff,
+0x210800,
+0x061000,
+0xffffffff,
+0x0000d0,
+0xffffffff,
+0xffffffff,
+0xc00008,
+0xffffffff,
+0x101400,
+0x080900,
+0xffffffff,
+0xffffffff,
+0xc00002,
+0xc00001,
+0xc00000,
+0x00a020,
+0xffffffff,
+0xffffffff,
+0xc00004,
+0x0000e0,
+0xffffffff,
+0xffffffff,
+0x004204,
+0xffffffff,
+0x004202,
+0x004201,
+0x004200,
+0xffffffff,
+0x081100,
+0x100c00,
+0xffffffff,
+0x00a010,
+0xffffffff,
+0xffffffff,
+0x004208,
+0xffffffff,
+0x060800,
+0x211000,
+0xffffffff,
+0x00a008,
+0xffffffff,
+0xffffffff,
+0x004210,
+0x00a004,
+0xffffffff,
+0xffffffff,
+0xc00020,
+0x00a000,
+0x00a001,
+0x00a002,
+0xffffffff,
+0x000100,
+0x000101,
+0x000102,
+0x000103,
+0x000104,
+0x000105,
+0x000106,
+0xffffffff,
+0x000108,
+0x000109,
+0x00010a,
+0xffffffff,
+0x00010c,
+0xffffffff,
+0xffffffff,
+0x002480,
+0x000110,
+0x000111,
+0x000112,
+0xffffffff,
+0x000114,
+0xffffffff,
+0xffffffff,
+0x504000,
+0x000118,
+0xffffffff,
+0xffffffff,
+0x290000,
+0xffffffff,
+0x020240,
+0x848000,
+0xffffffff,
+0x000120,
+0x000121,
+0x000122,
+0xffffffff,
+0x000124,
+0xffffffff,
+0xffffffff,
+0x0e0000,
+0x000128,
+0xffffffff,
+0xffffffff,
+0x900200,
+0xffffffff,
+0x01c000,
+0x600040,
+0xffffffff,
+0x000130,
+0xffffffff,
+0xffffffff,
+0x008440,
+0xffffffff,
+0xa00080,
+0x012200,
+0xffffffff,
+0xffffffff,
+0x442000,
+0x024080,
+0xffffffff,
+0x180400,
+0xffffffff,
+0xffffffff,
+0x001900,
+0x000140,
+0x000141,
+0x000142,
+0xffffffff,
+0x000144,
+0xffffffff,
+0xffffffff,
+0x811000,
+0x000148,
+0xffffffff,
+0xffffffff,
+0x044800,
+0xffffffff,
+0x020210,
+0x600020,
+0xffffffff,
+0x000150,
+0xffffffff,
+0xffffffff,
+0x008420,
+0xffffffff,
+0x020208,
+0x080880,
+0xffffffff,
+0xffffffff,
+0x020204,
+0x103000,
+0xffffffff,
+0x020201,
+0x020200,
+0xffffffff,
+0x020202,
+0x000160,
+0xffffffff,
+0xffffffff,
+0x008410,
+0xffffffff,
+0x102800,
+0x600008,
+0xffffffff,
+0xffffffff,
+0x081080,
+0x600004,
+0xffffffff,
+0x600002,
+0xffffffff,
+0x600000,
+0x600001,
+0xffffffff,
+0x008402,
+0x008401,
+0x008400,
+0x045000,
+0xffffffff,
+0xffffffff,
+0x008404,
+0x810800,
+0xffffffff,
+0xffffffff,
+0x008408,
+0xffffffff,
+0x020220,
+0x600010,
+0xffffffff,
+0x000180,
+0x000181,
+0x000182,
+0xffffffff,
+0x000184,
+0xffffffff,
+0xffffffff,
+0x002408,
+0x000188,
+0xffffffff,
+0xffffffff,
+0x002404,
+0xffffffff,
+0x002402,
+0x002401,
+0x002400,
+0x000190,
+0xffffffff,
+0xffffffff,
+0x041200,
+0xffffffff,
+0xa00020,
+0x080840,
+0xffffffff,
+0xffffffff,
+0x108800,
+0x024020,
+0xffffffff,
+0x411000,
+0xffffffff,
+0xffffffff,
+0x002410,
+0x0001a0,
+0xffffffff,
+0xffffffff,
+0x410800,
+0xffffffff,
+0xa00010,
+0x109000,
+0xffffffff,
+0xffffffff,
+0x081040,
+0x024010,
+0xffffffff,
+0x040a00,
+0xffffffff,
+0xffffffff,
+0x002420,
+0xffffffff,
+0xa00004,
+0x024008,
+0xffffffff,
+0xa00001,
+0xa00000,
+0xffffffff,
+0xa00002,
+0x024002,
+0xffffffff,
+0x024000,
+0x024001,
+0xffffffff,
+0xa00008,
+0x024004,
+0xffffffff,
+0x0001c0,
+0xffffffff,
+0xffffffff,
+0x320000,
+0xffffffff,
+0x448000,
+0x080810,
+0xffffffff,
+0xffffffff,
+0x081020,
+0x018200,
+0xffffffff,
+0x904000,
+0xffffffff,
+0xffffffff,
+0x002440,
+0xffffffff,
+0x016000,
+0x080804,
+0xffffffff,
+0x080802,
+0xffffffff,
+0x080800,
+0x080801,
+0x240400,
+0xffffffff,
+0xffffffff,
+0xc00100,
+0xffffffff,
+0x020280,
+0x080808,
+0xffffffff,
+0xffffffff,
+0x081008,
+0x842000,
+0xffffffff,
+0x030400,
+0xffffffff,
+0xffffffff,
+0x004300,
+0x081001,
+0x081000,
+0xffffffff,
+0x081002,
+0xffffffff,
+0x081004,
+0x600080,
+0xffffffff,
+0x500200,
+0xffffffff,
+0xffffffff,
+0x008480,
+0xffffffff,
+0xa00040,
+0x080820,
+0xffffffff,
+0xffffffff,
+0x081010,
+0x024040,
+0xffffffff,
+0x00a100,
+0xffffffff,
+0xffffffff,
+0x150000,
+0x000200,
+0x000201,
+0x000202,
+0x000203,
+0x000204,
+0x000205,
+0x000206,
+0xffffffff,
+0x000208,
+0x000209,
+0x00020a,
+0xffffffff,
+0x00020c,
+0xffffffff,
+0xffffffff,
+0x450000,
+0x000210,
+0x000211,
+0x000212,
+0xffffffff,
+0x000214,
+0xffffffff,
+0xffffffff,
+0x880400,
+0x000218,
+0xffffffff,
+0xffffffff,
+0x00e000,
+0xffffffff,
+0x020140,
+0x300080,
+0xffffffff,
+0x000220,
+0x000221,
+0x000222,
+0xffffffff,
+0x000224,
+0xffffffff,
+0xffffffff,
+0x0040c0,
+0x000228,
+0xffffffff,
+0xffffffff,
+0x900100,
+0xffffffff,
+0x282000,
+0x028400,
+0xffffffff,
+0x000230,
+0xffffffff,
+0xffffffff,
+0x620000,
+0xffffffff,
+0x148000,
+0x012100,
+0xffffffff,
+0xffffffff,
+0x010480,
+0x0c0040,
+0xffffffff,
+0xc04000,
+0xffffffff,
+0xffffffff,
+0x001a00,
+0x000240,
+0x000241,
+0x000242,
+0xffffffff,
+0x000244,
+0xffffffff,
+0xffffffff,
+0x0040a0,
+0x000248,
+0xffffffff,
+0xffffffff,
+0x201400,
+0xffffffff,
+0x020110,
+0x802800,
+0xffffffff,
+0x000250,
+0xffffffff,
+0xffffffff,
+0x110800,
+0xffffffff,
+0x020108,
+0x409000,
+0xffffffff,
+0xffffffff,
+0x020104,
+0x0c0020,
+0xffffffff,
+0x020101,
+0x020100,
+0xffffffff,
+0x020102,
+0x000260,
+0xffffffff,
+0xffffffff,
+0x004084,
+0xffffffff,
+0x004082,
+0x004081,
+0x004080,
+0xffffffff,
+0x408800,
+0x0c0010,
+0xffffffff,
+0x111000,
+0xffffffff,
+0xffffffff,
+0x004088,
+0xffffffff,
+0x803000,
+0x0c0008,
+0xffffffff,
+0x200c00,
+0xffffffff,
+0xffffffff,
+0x004090,
+0x0c0002,
+0xffffffff,
+0x0c0000,
+0x0c0001,
+0xffffffff,
+0x020120,
+0x0c0004,
+0xffffffff,
+0x000280,
+0x000281,
+0x000282,
+0xffffffff,
+0x000284,
+0xffffffff,
+0xffffffff,
+0x004060,
+0x000288,
+0xffffffff,
+0xffffffff,
+0x0a0800,
+0xffffffff,
+0x809000,
+0x300010,
+0xffffffff,
+0x000290,
+0xffffffff,
+0xffffffff,
+0x041100,
+0xffffffff,
+0x402800,
+0x300008,
+0xffffffff,
+0xffffffff,
+0x010420,
+0x300004,
+0xffffffff,
+0x300002,
+0xffffffff,
+0x300000,
+0x300001,
+0x0002a0,
+0xffffffff,
+0xffffffff,
+0x004044,
+0xffffffff,
+0x004042,
+0x004041,
+0x004040,
+0xffffffff,
+0x010410,
+0x403000,
+0xffffffff,
+0x040900,
+0xffffffff,
+0xffffffff,
+0x004048,
+0xffffffff,
+0x010408,
+0x808800,
+0xffffffff,
+0x0a1000,
+0xffffffff,
+0xffffffff,
+0x004050,
+0x010401,
+0x010400,
+0xffffffff,
+0x010402,
+0xffffffff,
+0x010404,
+0x300020,
+0xffffffff,
+0x0002c0,
+0xffffffff,
+0xffffffff,
+0x004024,
+0xffffffff,
+0x004022,
+0x004021,
+0x004020,
+0xffffffff,
+0x142000,
+0x018100,
+0xffffffff,
+0x480400,
+0xffffffff,
+0xffffffff,
+0x004028,
+0xffffffff,
+0x288000,
+0x022400,
+0xffffffff,
+0x850000,
+0xffffffff,
+0xffffffff,
+0x004030,
+0x005800,
+0xffffffff,
+0xffffffff,
+0xc00200,
+0xffffffff,
+0x020180,
+0x300040,
+0xffffffff,
+0xffffffff,
+0x004006,
+0x004005,
+0x004004,
+0x004003,
+0x004002,
+0x004001,
+0x004000,
+0xa20000,
+0xffffffff,
+0xffffffff,
+0x00400c,
+0xffffffff,
+0x00400a,
+0x004009,
+0x004008,
+0x500100,
+0xffffffff,
+0xffffffff,
+0x004014,
+0xffffffff,
+0x004012,
+0x004011,
+0x004010,
+0xffffffff,
+0x010440,
+0x0c0080,
+0xffffffff,
+0x00a200,
+0xffffffff,
+0xffffffff,
+0x004018,
+0x000300,
+0x000301,
+0x000302,
+0xffffffff,
+0x000304,
+0xffffffff,
+0xffffffff,
+0x208800,
+0x000308,
+0xffffffff,
+0xffffffff,
+0x900020,
+0xffffffff,
+0x020050,
+0x085000,
+0xffffffff,
+0x000310,
+0xffffffff,
+0xffffffff,
+0x041080,
+0xffffffff,
+0x020048,
+0x012020,
+0xffffffff,
+0xffffffff,
+0x020044,
+0x400c00,
+0xffffffff,
+0x020041,
+0x020040,
+0xffffffff,
+0x020042,
+0x000320,
+0xffffffff,
+0xffffffff,
+0x900008,
+0xffffffff,
+0x401400,
+0x012010,
+0xffffffff,
+0xffffffff,
+0x900002,
+0x900001,
+0x900000,
+0x040880,
+0xffffffff,
+0xffffffff,
+0x900004,
+0xffffffff,
+0x084800,
+0x012004,
+0xffffffff,
+0x012002,
+0xffffffff,
+0x012000,
+0x012001,
+0x209000,
+0xffffffff,
+0xffffffff,
+0x900010,
+0xffffffff,
+0x020060,
+0x012008,
+0xffffffff,
+0x000340,
+0xffffffff,
+0xffffffff,
+0x482000,
+0xffffffff,
+0x020018,
+0x140400,
+0xffffffff,
+0xffffffff,
+0x020014,
+0x018080,
+0xffffffff,
+0x020011,
+0x020010,
+0xffffffff,
+0x020012,
+0xffffffff,
+0x02000c,
+0xa04000,
+0xffffffff,
+0x020009,
+0x020008,
+0xffffffff,
+0x02000a,
+0x020005,
+0x020004,
+0xffffffff,
+0x020006,
+0x020001,
+0x020000,
+0x020003,
+0x020002,
+0xffffffff,
+0x250000,
+0x021800,
+0xffffffff,
+0x888000,
+0xffffffff,
+0xffffffff,
+0x004180,
+0x006400,
+0xffffffff,
+0xffffffff,
+0x900040,
+0xffffffff,
+0x020030,
+0x600200,
+0xffffffff,
+0x500080,
+0xffffffff,
+0xffffffff,
+0x008600,
+0xffffffff,
+0x020028,
+0x012040,
+0xffffffff,
+0xffffffff,
+0x020024,
+0x0c0100,
+0xffffffff,
+0x020021,
+0x020020,
+0xffffffff,
+0x020022,
+0x000380,
+0xffffffff,
+0xffffffff,
+0x041010,
+0xffffffff,
+0x190000,
+0xc20000,
+0xffffffff,
+0xffffffff,
+0x604000,
+0x018040,
+0xffffffff,
+0x040820,
+0xffffffff,
+0xffffffff,
+0x002600,
+0xffffffff,
+0x041002,
+0x041001,
+0x041000,
+0x00c400,
+0xffffffff,
+0xffffffff,
+0x041004,
+0x882000,
+0xffffffff,
+0xffffffff,
+0x041008,
+0xffffffff,
+0x0200c0,
+0x300100,
+0xffffffff,
+0xffffffff,
+0x02a000,
+0x280400,
+0xffffffff,
+0x040808,
+0xffffffff,
+0xffffffff,
+0x004140,
+0x040804,
+0xffffffff,
+0xffffffff,
+0x900080,
+0x040800,
+0x040801,
+0x040802,
+0xffffffff,
+0x500040,
+0xffffffff,
+0xffffffff,
+0x041020,
+0xffffffff,
+0xa00200,
+0x012080,
+0xffffffff,
+0xffffffff,
+0x010500,
+0x024200,
+0xffffffff,
+0x040810,
+0xffffffff,
+0xffffffff,
+0x488000,
+0xffffffff,
+0x800c00,
+0x018008,
+0xffffffff,
+0x203000,
+0xffffffff,
+0xffffffff,
+0x004120,
+0x018002,
+0xffffffff,
+0x018000,
+0x018001,
+0xffffffff,
+0x020090,
+0x018004,
+0xffffffff,
+0x500020,
+0xffffffff,
+0xffffffff,
+0x041040,
+0xffffffff,
+0x020088,
+0x080a00,
+0xffffffff,
+0xffffffff,
+0x020084,
+0x018010,
+0xffffffff,
+0x020081,
+0x020080,
+0xffffffff,
+0x020082,
+0x500010,
+0xffffffff,
+0xffffffff,
+0x004104,
+0xffffffff,
+0x004102,
+0x004101,
+0x004100,
+0xffffffff,
+0x081200,
+0x018020,
+0xffffffff,
+0x040840,
+0xffffffff,
+0xffffffff,
+0x004108,
+0x500000,
+0x500001,
+0x500002,
+0xffffffff,
+0x500004,
+0xffffffff,
+0xffffffff,
+0x004110,
+0x500008,
+0xffffffff,
+0xffffffff,
+0x202800,
+0xffffffff,
+0x0200a0,
+0x801400,
+0xffffffff,
+0x000400,
+0x000401,
+0x000402,
+0x000403,
+0x000404,
+0x000405,
+0x000406,
+0xffffffff,
+0x000408,
+0x000409,
+0x00040a,
+0xffffffff,
+0x00040c,
+0xffffffff,
+0xffffffff,
+0x002180,
+0x000410,
+0x000411,
+0x000412,
+0xffffffff,
+0x000414,
+0xffffffff,
+0xffffffff,
+0x880200,
+0x000418,
+0xffffffff,
+0xffffffff,
+0x160000,
+0xffffffff,
+0x608000,
+0x014040,
+0xffffffff,
+0x000420,
+0x000421,
+0x000422,
+0xffffffff,
+0x000424,
+0xffffffff,
+0xffffffff,
+0x310000,
+0x000428,
+0xffffffff,
+0xffffffff,
+0x484000,
+0xffffffff,
+0x840040,
+0x028200,
+0xffffffff,
+0x000430,
+0xffffffff,
+0xffffffff,
+0x008140,
+0xffffffff,
+0x026000,
+0x440080,
+0xffffffff,
+0xffffffff,
+0x010280,
+0xa02000,
+0xffffffff,
+0x180100,
+0xffffffff,
+0xffffffff,
+0x001c00,
+0x000440,
+0x000441,
+0x000442,
+0xffffffff,
+0x000444,
+0xffffffff,
+0xffffffff,
+0x420800,
+0x000448,
+0xffffffff,
+0xffffffff,
+0x201200,
+0xffffffff,
+0x840020,
+0x014010,
+0xffffffff,
+0x000450,
+0xffffffff,
+0xffffffff,
+0x008120,
+0xffffffff,
+0x101080,
+0x014008,
+0xffffffff,
+0xffffffff,
+0x082800,
+0x014004,
+0xffffffff,
+0x014002,
+0xffffffff,
+0x014000,
+0x014001,
+0x000460,
+0xffffffff,
+0xffffffff,
+0x008110,
+0xffffffff,
+0x840008,
+0x083000,
+0xffffffff,
+0xffffffff,
+0x840004,
+0x100880,
+0xffffffff,
+0x840001,
+0x840000,
+0xffffffff,
+0x840002,
+0xffffffff,
+0x008102,
+0x008101,
+0x008100,
+0x200a00,
+0xffffffff,
+0xffffffff,
+0x008104,
+0x421000,
+0xffffffff,
+0xffffffff,
+0x008108,
+0xffffffff,
+0x840010,
+0x014020,
+0xffffffff,
+0x000480,
+0x000481,
+0x000482,
+0xffffffff,
+0x000484,
+0xffffffff,
+0xffffffff,
+0x002108,
+0x000488,
+0xffffffff,
+0xffffffff,
+0x002104,
+0xffffffff,
+0x002102,
+0x002101,
+0x002100,
+0x000490,
+0xffffffff,
+0xffffffff,
+0x204800,
+0xffffffff,
+0x101040,
+0x440020,
+0xffffffff,
+0xffffffff,
+0x010220,
+0x089000,
+0xffffffff,
+0x820800,
+0xffffffff,
+0xffffffff,
+0x002110,
+0x0004a0,
+0xffffffff,
+0xffffffff,
+0x821000,
+0xffffffff,
+0x088800,
+0x440010,
+0xffffffff,
+0xffffffff,
+0x010210,
+0x100840,
+0xffffffff,
+0x205000,
+0xffffffff,
+0xffffffff,
+0x002120,
+0xffffffff,
+0x010208,
+0x440004,
+0xffffffff,
+0x440002,
+0xffffffff,
+0x440000,
+0x440001,
+0x010201,
+0x010200,
+0xffffffff,
+0x010202,
+0xffffffff,
+0x010204,
+0x440008,
+0xffffffff,
+0x0004c0,
+0xffffffff,
+0xffffffff,
+0x0d0000,
+0xffffffff,
+0x101010,
+0xa08000,
+0xffffffff,
+0xffffffff,
+0x02c000,
+0x100820,
+0xffffffff,
+0x480200,
+0xffffffff,
+0xffffffff,
+0x002140,
+0xffffffff,
+0x101004,
+0x022200,
+0xffffffff,
+0x101001,
+0x101000,
+0xffffffff,
+0x101002,
+0x240100,
+0xffffffff,
+0xffffffff,
+0xc00400,
+0xffffffff,
+0x101008,
+0x014080,
+0xffffffff,
+0xffffffff,
+0x602000,
+0x100808,
+0xffffffff,
+0x030100,
+0xffffffff,
+0xffffffff,
+0x004600,
+0x100802,
+0xffffffff,
+0x100800,
+0x100801,
+0xffffffff,
+0x840080,
+0x100804,
+0xffffffff,
+0x884000,
+0xffffffff,
+0xffffffff,
+0x008180,
+0xffffffff,
+0x101020,
+0x440040,
+0xffffffff,
+0xffffffff,
+0x010240,
+0x100810,
+0xffffffff,
+0x00a400,
+0xffffffff,
+0xffffffff,
+0x2a0000,
+0x000500,
+0x000501,
+0x000502,
+0xffffffff,
+0x000504,
+0xffffffff,
+0xffffffff,
+0x002088,
+0x000508,
+0xffffffff,
+0xffffffff,
+0x002084,
+0xffffffff,
+0x002082,
+0x002081,
+0x002080,
+0x000510,
+0xffffffff,
+0xffffffff,
+0x008060,
+0xffffffff,
+0x050800,
+0x221000,
+0xffffffff,
+0xffffffff,
+0x805000,
+0x400a00,
+0xffffffff,
+0x180020,
+0xffffffff,
+0xffffffff,
+0x002090,
+0x000520,
+0xffffffff,
+0xffffffff,
+0x008050,
+0xffffffff,
+0x401200,
+0x804800,
+0xffffffff,
+0xffffffff,
+0x220800,
+0x051000,
+0xffffffff,
+0x180010,
+0xffffffff,
+0xffffffff,
+0x0020a0,
+0xffffffff,
+0x008042,
+0x008041,
+0x008040,
+0x180008,
+0xffffffff,
+0xffffffff,
+0x008044,
+0x180004,
+0xffffffff,
+0xffffffff,
+0x008048,
+0x180000,
+0x180001,
+0x180002,
+0xffffffff,
+0x000540,
+0xffffffff,
+0xffffffff,
+0x008030,
+0xffffffff,
+0x284000,
+0x140200,
+0xffffffff,
+0xffffffff,
+0x510000,
+0x8a0000,
+0xffffffff,
+0x009800,
+0xffffffff,
+0xffffffff,
+0x0020c0,
+0xffffffff,
+0x008022,
+0x008021,
+0x008020,
+0xc02000,
+0xffffffff,
+0xffffffff,
+0x008024,
+0x240080,
+0xffffffff,
+0xffffffff,
+0x008028,
+0xffffffff,
+0x020600,
+0x014100,
+0xffffffff,
+0xffffffff,
+0x008012,
+0x008011,
+0x008010,
+0x030080,
+0xffffffff,
+0xffffffff,
+0x008014,
+0x006200,
+0xffffffff,
+0xffffffff,
+0x008018,
+0xffffffff,
+0x840100,
+0x600400,
+0xffffffff,
+0x008003,
+0x008002,
+0x008001,
+0x008000,
+0xffffffff,
+0x008006,
+0x008005,
+0x008004,
+0xffffffff,
+0x00800a,
+0x008009,
+0x008008,
+0x180040,
+0xffffffff,
+0xffffffff,
+0x00800c,
+0x000580,
+0xffffffff,
+0xffffffff,
+0x00200c,
+0xffffffff,
+0x00200a,
+0x002009,
+0x002008,
+0xffffffff,
+0x002006,
+0x002005,
+0x002004,
+0x002003,
+0x002002,
+0x002001,
+0x002000,
+0xffffffff,
+0x4a0000,
+0x910000,
+0xffffffff,
+0x00c200,
+0xffffffff,
+0xffffffff,
+0x002018,
+0x240040,
+0xffffffff,
+0xffffffff,
+0x002014,
+0xffffffff,
+0x002012,
+0x002011,
+0x002010,
+0xffffffff,
+0x144000,
+0x280200,
+0xffffffff,
+0x030040,
+0xffffffff,
+0xffffffff,
+0x002028,
+0xc08000,
+0xffffffff,
+0xffffffff,
+0x002024,
+0xffffffff,
+0x002022,
+0x002021,
+0x002020,
+0x003800,
+0xffffffff,
+0xffffffff,
+0x0080c0,
+0xffffffff,
+0xa00400,
+0x440100,
+0xffffffff,
+0xffffffff,
+0x010300,
+0x024400,
+0xffffffff,
+0x180080,
+0xffffffff,
+0xffffffff,
+0x002030,
+0xffffffff,
+0x800a00,
+0x405000,
+0xffffffff,
+0x030020,
+0xffffffff,
+0xffffffff,
+0x002048,
+0x240010,
+0xffffffff,
+0xffffffff,
+0x002044,
+0xffffffff,
+0x002042,
+0x002041,
+0x002040,
+0x240008,
+0xffffffff,
+0xffffffff,
+0x0080a0,
+0xffffffff,
+0x101100,
+0x080c00,
+0xffffffff,
+0x240000,
+0x240001,
+0x240002,
+0xffffffff,
+0x240004,
+0xffffffff,
+0xffffffff,
+0x002050,
+0x030004,
+0xffffffff,
+0xffffffff,
+0x008090,
+0x030000,
+0x030001,
+0x030002,
+0xffffffff,
+0xffffffff,
+0x081400,
+0x100900,
+0xffffffff,
+0x030008,
+0xffffffff,
+0xffffffff,
+0x002060,
+0xffffffff,
+0x008082,
+0x008081,
+0x008080,
+0x030010,
+0xffffffff,
+0xffffffff,
+0x008084,
+0x240020,
+0xffffffff,
+0xffffffff,
+0x008088,
+0xffffffff,
+0x404800,
+0x801200,
+0xffffffff,
+0x000600,
+0x000601,
+0x000602,
+0xffffffff,
+0x000604,
+0xffffffff,
+0xffffffff,
+0x880010,
+0x000608,
+0xffffffff,
+0xffffffff,
+0x201040,
+0xffffffff,
+0x104800,
+0x028020,
+0xffffffff,
+0x000610,
+0xffffffff,
+0xffffffff,
+0x880004,
+0xffffffff,
+0x880002,
+0x880001,
+0x880000,
+0xffffffff,
+0x0100a0,
+0x400900,
+0xffffffff,
+0x043000,
+0xffffffff,
+0xffffffff,
+0x880008,
+0x000620,
+0xffffffff,
+0xffffffff,
+0x042800,
+0xffffffff,
+0x401100,
+0x028008,
+0xffffffff,
+0xffffffff,
+0x010090,
+0x028004,
+0xffffffff,
+0x028002,
+0xffffffff,
+0x028000,
+0x028001,
+0xffffffff,
+0x010088,
+0x105000,
+0xffffffff,
+0x200840,
+0xffffffff,
+0xffffffff,
+0x880020,
+0x010081,
+0x010080,
+0xffffffff,
+0x010082,
+0xffffffff,
+0x010084,
+0x028010,
+0xffffffff,
+0x000640,
+0xffffffff,
+0xffffffff,
+0x201008,
+0xffffffff,
+0x01a000,
+0x140100,
+0xffffffff,
+0xffffffff,
+0x201002,
+0x201001,
+0x201000,
+0x480080,
+0xffffffff,
+0xffffffff,
+0x201004,
+0xffffffff,
+0x444000,
+0x022080,
+0xffffffff,
+0x200820,
+0xffffffff,
+0xffffffff,
+0x880040,
+0x908000,
+0xffffffff,
+0xffffffff,
+0x201010,
+0xffffffff,
+0x020500,
+0x014200,
+0xffffffff,
+0xffffffff,
+0x1a0000,
+0xc10000,
+0xffffffff,
+0x200810,
+0xffffffff,
+0xffffffff,
+0x004480,
+0x006100,
+0xffffffff,
+0xffffffff,
+0x201020,
+0xffffffff,
+0x840200,
+0x028040,
+0xffffffff,
+0x200804,
+0xffffffff,
+0xffffffff,
+0x008300,
+0x200800,
+0x200801,
+0x200802,
+0xffffffff,
+0xffffffff,
+0x0100c0,
+0x0c0400,
+0xffffffff,
+0x200808,
+0xffffffff,
+0xffffffff,
+0x502000,
+0x000680,
+0xffffffff,
+0xffffffff,
+0x508000,
+0xffffffff,
+0x260000,
+0x011800,
+0xffffffff,
+0xffffffff,
+0x010030,
+0x844000,
+0xffffffff,
+0x480040,
+0xffffffff,
+0xffffffff,
+0x002300,
+0xffffffff,
+0x010028,
+0x022040,
+0xffffffff,
+0x00c100,
+0xffffffff,
+0xffffffff,
+0x880080,
+0x010021,
+0x010020,
+0xffffffff,
+0x010022,
+0xffffffff,
+0x010024,
+0x300400,
+0xffffffff,
+0xffffffff,
+0x010018,
+0x280100,
+0xffffffff,
+0x902000,
+0xffffffff,
+0xffffffff,
+0x004440,
+0x010011,
+0x010010,
+0xffffffff,
+0x010012,
+0xffffffff,
+0x010014,
+0x028080,
+0xffffffff,
+0x010009,
+0x010008,
+0xffffffff,
+0x01000a,
+0xffffffff,
+0x01000c,
+0x440200,
+0xffffffff,
+0x010001,
+0x010000,
+0x010003,
+0x010002,
+0x010005,
+0x010004,
+0xffffffff,
+0x010006,
+0xffffffff,
+0x800900,
+0x022010,
+0xffffffff,
+0x480008,
+0xffffffff,
+0xffffffff,
+0x004420,
+0x480004,
+0xffffffff,
+0xffffffff,
+0x201080,
+0x480000,
+0x480001,
+0x480002,
+0xffffffff,
+0x022002,
+0xffffffff,
+0x022000,
+0x022001,
+0xffffffff,
+0x101200,
+0x022004,
+0xffffffff,
+0xffffffff,
+0x010060,
+0x022008,
+0xffffffff,
+0x480010,
+0xffffffff,
+0xffffffff,
+0x048800,
+0x049000,
+0xffffffff,
+0xffffffff,
+0x004404,
+0xffffffff,
+0x004402,
+0x004401,
+0x004400,
+0xffffffff,
+0x010050,
+0x100a00,
+0xffffffff,
+0x480020,
+0xffffffff,
+0xffffffff,
+0x004408,
+0xffffffff,
+0x010048,
+0x022020,
+0xffffffff,
+0x200880,
+0xffffffff,
+0xffffffff,
+0x004410,
+0x010041,
+0x010040,
+0xffffffff,
+0x010042,
+0xffffffff,
+0x010044,
+0x801100,
+0xffffffff,
+0x000700,
+0xffffffff,
+0xffffffff,
+0x034000,
+0xffffffff,
+0x401020,
+0x140040,
+0xffffffff,
+0xffffffff,
+0x0c8000,
+0x400810,
+0xffffffff,
+0xa10000,
+0xffffffff,
+0xffffffff,
+0x002280,
+0xffffffff,
+0x302000,
+0x400808,
+0xffffffff,
+0x00c080,
+0xffffffff,
+0xffffffff,
+0x880100,
+0x400802,
+0xffffffff,
+0x400800,
+0x400801,
+0xffffffff,
+0x020440,
+0x400804,
+0xffffffff,
+0xffffffff,
+0x401004,
+0x280080,
+0xffffffff,
+0x401001,
+0x401000,
+0xffffffff,
+0x401002,
+0x006040,
+0xffffffff,
+0xffffffff,
+0x900400,
+0xffffffff,
+0x401008,
+0x028100,
+0xffffffff,
+0x860000,
+0xffffffff,
+0xffffffff,
+0x008240,
+0xffffffff,
+0x401010,
+0x012400,
+0xffffffff,
+0xffffffff,
+0x010180,
+0x400820,
+0xffffffff,
+0x180200,
+0xffffffff,
+0xffffffff,
+0x244000,
+0xffffffff,
+0x800880,
+0x140004,
+0xffffffff,
+0x140002,
+0xffffffff,
+0x140000,
+0x140001,
+0x006020,
+0xffffffff,
+0xffffffff,
+0x201100,
+0xffffffff,
+0x020410,
+0x140008,
+0xffffffff,
+0x091000,
+0xffffffff,
+0xffffffff,
+0x008220,
+0xffffffff,
+0x020408,
+0x140010,
+0xffffffff,
+0xffffffff,
+0x020404,
+0x400840,
+0xffffffff,
+0x020401,
+0x020400,
+0xffffffff,
+0x020402,
+0x006008,
+0xffffffff,
+0xffffffff,
+0x008210,
+0xffffffff,
+0x401040,
+0x140020,
+0xffffffff,
+0x006000,
+0x006001,
+0x006002,
+0xffffffff,
+0x006004,
+0xffffffff,
+0xffffffff,
+0x090800,
+0xffffffff,
+0x008202,
+0x008201,
+0x008200,
+0x200900,
+0xffffffff,
+0xffffffff,
+0x008204,
+0x006010,
+0xffffffff,
+0xffffffff,
+0x008208,
+0xffffffff,
+0x020420,
+0x801080,
+0xffffffff,
+0xffffffff,
+0x800840,
+0x280020,
+0xffffffff,
+0x00c010,
+0xffffffff,
+0xffffffff,
+0x002208,
+0x121000,
+0xffffffff,
+0xffffffff,
+0x002204,
+0xffffffff,
+0x002202,
+0x002201,
+0x002200,
+0x00c004,
+0xffffffff,
+0xffffffff,
+0x041400,
+0x00c000,
+0x00c001,
+0x00c002,
+0xffffffff,
+0xffffffff,
+0x010120,
+0x400880,
+0xffffffff,
+0x00c008,
+0xffffffff,
+0xffffffff,
+0x002210,
+0x280002,
+0xffffffff,
+0x280000,
+0x280001,
+0xffffffff,
+0x401080,
+0x280004,
+0xffffffff,
+0xffffffff,
+0x010110,
+0x280008,
+0xffffffff,
+0x040c00,
+0xffffffff,
+0xffffffff,
+0x002220,
+0xffffffff,
+0x010108,
+0x280010,
+0xffffffff,
+0x00c020,
+0xffffffff,
+0xffffffff,
+0x120800,
+0x010101,
+0x010100,
+0xffffffff,
+0x010102,
+0xffffffff,
+0x010104,
+0x801040,
+0xffffffff,
+0x800801,
+0x800800,
+0xffffffff,
+0x800802,
+0xffffffff,
+0x800804,
+0x140080,
+0xffffffff,
+0xffffffff,
+0x800808,
+0x018400,
+0xffffffff,
+0x480100,
+0xffffffff,
+0xffffffff,
+0x002240,
+0xffffffff,
+0x800810,
+0x022100,
+0xffffffff,
+0x00c040,
+0xffffffff,
+0xffffffff,
+0x610000,
+0x240200,
+0xffffffff,
+0xffffffff,
+0x184000,
+0xffffffff,
+0x020480,
+0x801020,
+0xffffffff,
+0xffffffff,
+0x800820,
+0x280040,
+0xffffffff,
+0x030200,
+0xffffffff,
+0xffffffff,
+0x004500,
+0x006080,
+0xffffffff,
+0xffffffff,
+0x460000,
+0xffffffff,
+0x308000,
+0x801010,
+0xffffffff,
+0x500400,
+0xffffffff,
+0xffffffff,
+0x008280,
+0xffffffff,
+0x0c2000,
+0x801008,
+0xffffffff,
+0xffffffff,
+0x010140,
+0x801004,
+0xffffffff,
+0x801002,
+0xffffffff,
+0x801000,
+0x801001,
+0x000800,
+0x000801,
+0x000802,
+0x000803,
+0x000804,
+0x000805,
+0x000806,
+0xffffffff,
+0x000808,
+0x000809,
+0x00080a,
+0xffffffff,
+0x00080c,
+0xffffffff,
+0xffffffff,
+0x001030,
+0x000810,
+0x000811,
+0x000812,
+0xffffffff,
+0x000814,
+0xffffffff,
+0xffffffff,
+0x001028,
+0x000818,
+0xffffffff,
+0xffffffff,
+0x001024,
+0xffffffff,
+0x001022,
+0x001021,
+0x001020,
+0x000820,
+0x000821,
+0x000822,
+0xffffffff,
+0x000824,
+0xffffffff,
+0xffffffff,
+0x001018,
+0x000828,
+0xffffffff,
+0xffffffff,
+0x001014,
+0xffffffff,
+0x001012,
+0x001011,
+0x001010,
+0x000830,
+0xffffffff,
+0xffffffff,
+0x00100c,
+0xffffffff,
+0x00100a,
+0x001009,
+0x001008,
+0xffffffff,
+0x001006,
+0x001005,
+0x001004,
+0x001003,
+0x001002,
+0x001001,
+0x001000,
+0x000840,
+0x000841,
+0x000842,
+0xffffffff,
+0x000844,
+0xffffffff,
+0xffffffff,
+0x420400,
+0x000848,
+0xffffffff,
+0xffffffff,
+0x044100,
+0xffffffff,
+0x210080,
+0x802200,
+0xffffffff,
+0x000850,
+0xffffffff,
+0xffffffff,
+0x110200,
+0xffffffff,
+0x80c000,
+0x080180,
+0xffffffff,
+0xffffffff,
+0x082400,
+0x228000,
+0xffffffff,
+0x540000,
+0xffffffff,
+0xffffffff,
+0x001060,
+0x000860,
+0xffffffff,
+0xffffffff,
+0xa80000,
+0xffffffff,
+0x102100,
+0x058000,
+0xffffffff,
+0xffffffff,
+0x408200,
+0x100480,
+0xffffffff,
+0x0a4000,
+0xffffffff,
+0xffffffff,
+0x001050,
+0xffffffff,
+0x060080,
+0x406000,
+0xffffffff,
+0x200600,
+0xffffffff,
+0xffffffff,
+0x001048,
+0x810100,
+0xffffffff,
+0xffffffff,
+0x001044,
+0xffffffff,
+0x001042,
+0x001041,
+0x001040,
+0x000880,
+0x000881,
+0x000882,
+0xffffffff,
+0x000884,
+0xffffffff,
+0xffffffff,
+0x940000,
+0x000888,
+0xffffffff,
+0xffffffff,
+0x0a0200,
+0xffffffff,
+0x210040,
+0x40c000,
+0xffffffff,
+0x000890,
+0xffffffff,
+0xffffffff,
+0x204400,
+0xffffffff,
+0x402200,
+0x080140,
+0xffffffff,
+0xffffffff,
+0x108100,
+0x052000,
+0xffffffff,
+0x820400,
+0xffffffff,
+0xffffffff,
+0x0010a0,
+0x0008a0,
+0xffffffff,
+0xffffffff,
+0x410100,
+0xffffffff,
+0x088400,
+0x222000,
+0xffffffff,
+0xffffffff,
+0x806000,
+0x100440,
+0xffffffff,
+0x040300,
+0xffffffff,
+0xffffffff,
+0x001090,
+0xffffffff,
+0x060040,
+0x808200,
+0xffffffff,
+0x114000,
+0xffffffff,
+0xffffffff,
+0x001088,
+0x680000,
+0xffffffff,
+0xffffffff,
+0x001084,
+0xffffffff,
+0x001082,
+0x001081,
+0x001080,
+0x0008c0,
+0xffffffff,
+0xffffffff,
+0x00b000,
+0xffffffff,
+0x210008,
+0x080110,
+0xffffffff,
+0xffffffff,
+0x210004,
+0x100420,
+0xffffffff,
+0x210001,
+0x210000,
+0xffffffff,
+0x210002,
+0xffffffff,
+0x060020,
+0x080104,
+0xffffffff,
+0x080102,
+0xffffffff,
+0x080100,
+0x080101,
+0x005200,
+0xffffffff,
+0xffffffff,
+0xc00800,
+0xffffffff,
+0x210010,
+0x080108,
+0xffffffff,
+0xffffffff,
+0x060010,
+0x100408,
+0xffffffff,
+0xc01000,
+0xffffffff,
+0xffffffff,
+0x004a00,
+0x100402,
+0xffffffff,
+0x100400,
+0x100401,
+0xffffffff,
+0x210020,
+0x100404,
+0xffffffff,
+0x060001,
+0x060000,
+0xffffffff,
+0x060002,
+0xffffffff,
+0x060004,
+0x080120,
+0xffffffff,
+0xffffffff,
+0x060008,
+0x100410,
+0xffffffff,
+0x00a800,
+0xffffffff,
+0xffffffff,
+0x0010c0,
+0x000900,
+0x000901,
+0x000902,
+0xffffffff,
+0x000904,
+0xffffffff,
+0xffffffff,
+0x208200,
+0x000908,
+0xffffffff,
+0xffffffff,
+0x044040,
+0xffffffff,
+0xc80000,
+0x130000,
+0xffffffff,
+0x000910,
+0xffffffff,
+0xffffffff,
+0x822000,
+0xffffffff,
+0x050400,
+0x0800c0,
+0xffffffff,
+0xffffffff,
+0x108080,
+0x400600,
+0xffffffff,
+0x206000,
+0xffffffff,
+0xffffffff,
+0x001120,
+0x000920,
+0xffffffff,
+0xffffffff,
+0x410080,
+0xffffffff,
+0x102040,
+0x804400,
+0xffffffff,
+0xffffffff,
+0x220400,
+0x08a000,
+0xffffffff,
+0x040280,
+0xffffffff,
+0xffffffff,
+0x001110,
+0xffffffff,
+0x084200,
+0x340000,
+0xffffffff,
+0x428000,
+0xffffffff,
+0xffffffff,
+0x001108,
+0x810040,
+0xffffffff,
+0xffffffff,
+0x001104,
+0xffffffff,
+0x001102,
+0x001101,
+0x001100,
+0x000940,
+0xffffffff,
+0xffffffff,
+0x044008,
+0xffffffff,
+0x102020,
+0x080090,
+0xffffffff,
+0xffffffff,
+0x044002,
+0x044001,
+0x044000,
+0x009400,
+0xffffffff,
+0xffffffff,
+0x044004,
+0xffffffff,
+0x601000,
+0x080084,
+0xffffffff,
+0x080082,
+0xffffffff,
+0x080080,
+0x080081,
+0x810020,
+0xffffffff,
+0xffffffff,
+0x044010,
+0xffffffff,
+0x020a00,
+0x080088,
+0xffffffff,
+0xffffffff,
+0x102004,
+0x021200,
+0xffffffff,
+0x102001,
+0x102000,
+0xffffffff,
+0x102002,
+0x810010,
+0xffffffff,
+0xffffffff,
+0x044020,
+0xffffffff,
+0x102008,
+0x600800,
+0xffffffff,
+0x810008,
+0xffffffff,
+0xffffffff,
+0x008c00,
+0xffffffff,
+0x102010,
+0x0800a0,
+0xffffffff,
+0x810000,
+0x810001,
+0x810002,
+0xffffffff,
+0x810004,
+0xffffffff,
+0xffffffff,
+0x001140,
+0x000980,
+0xffffffff,
+0xffffffff,
+0x410020,
+0xffffffff,
+0x025000,
+0x080050,
+0xffffffff,
+0xffffffff,
+0x108010,
+0xa01000,
+0xffffffff,
+0x040220,
+0xffffffff,
+0xffffffff,
+0x002c00,
+0xffffffff,
+0x108008,
+0x080044,
+0xffffffff,
+0x080042,
+0xffffffff,
+0x080040,
+0x080041,
+0x108001,
+0x108000,
+0xffffffff,
+0x108002,
+0xffffffff,
+0x108004,
+0x080048,
+0xffffffff,
+0xffffffff,
+0x410002,
+0x410001,
+0x410000,
+0x040208,
+0xffffffff,
+0xffffffff,
+0x410004,
+0x040204,
+0xffffffff,
+0xffffffff,
+0x410008,
+0x040200,
+0x040201,
+0x040202,
+0xffffffff,
+0x003400,
+0xffffffff,
+0xffffffff,
+0x410010,
+0xffffffff,
+0xa00800,
+0x080060,
+0xffffffff,
+0xffffffff,
+0x108020,
+0x024800,
+0xffffffff,
+0x040210,
+0xffffffff,
+0xffffffff,
+0x001180,
+0xffffffff,
+0x800600,
+0x080014,
+0xffffffff,
+0x080012,
+0xffffffff,
+0x080010,
+0x080011,
+0x422000,
+0xffffffff,
+0xffffffff,
+0x044080,
+0xffffffff,
+0x210100,
+0x080018,
+0xffffffff,
+0x080006,
+0xffffffff,
+0x080004,
+0x080005,
+0x080002,
+0x080003,
+0x080000,
+0x080001,
+0xffffffff,
+0x108040,
+0x08000c,
+0xffffffff,
+0x08000a,
+0xffffffff,
+0x080008,
+0x080009,
+0x20c000,
+0xffffffff,
+0xffffffff,
+0x410040,
+0xffffffff,
+0x102080,
+0x080030,
+0xffffffff,
+0xffffffff,
+0x081800,
+0x100500,
+0xffffffff,
+0x040240,
+0xffffffff,
+0xffffffff,
+0x828000,
+0xffffffff,
+0x060100,
+0x080024,
+0xffffffff,
+0x080022,
+0xffffffff,
+0x080020,
+0x080021,
+0x810080,
+0xffffffff,
+0xffffffff,
+0x202200,
+0xffffffff,
+0x404400,
+0x080028,
+0xffffffff,
+0x000a00,
+0x000a01,
+0x000a02,
+0xffffffff,
+0x000a04,
+0xffffffff,
+0xffffffff,
+0x208100,
+0x000a08,
+0xffffffff,
+0xffffffff,
+0x0a0080,
+0xffffffff,
+0x104400,
+0x802040,
+0xffffffff,
+0x000a10,
+0xffffffff,
+0xffffffff,
+0x110040,
+0xffffffff,
+0x402080,
+0x064000,
+0xffffffff,
+0xffffffff,
+0xa40000,
+0x400500,
+0xffffffff,
+0x098000,
+0xffffffff,
+0xffffffff,
+0x001220,
+0x000a20,
+0xffffffff,
+0xffffffff,
+0x042400,
+0xffffffff,
+0x830000,
+0x580000,
+0xffffffff,
+0xffffffff,
+0x408040,
+0x214000,
+0xffffffff,
+0x040180,
+0xffffffff,
+0xffffffff,
+0x001210,
+0xffffffff,
+0x084100,
+0x808080,
+0xffffffff,
+0x200440,
+0xffffffff,
+0xffffffff,
+0x001208,
+0x122000,
+0xffffffff,
+0xffffffff,
+0x001204,
+0xffffffff,
+0x001202,
+0x001201,
+0x001200,
+0x000a40,
+0xffffffff,
+0xffffffff,
+0x110010,
+0xffffffff,
+0x0c1000,
+0x802008,
+0xffffffff,
+0xffffffff,
+0x408020,
+0x802004,
+0xffffffff,
+0x802002,
+0xffffffff,
+0x802000,
+0x802001,
+0xffffffff,
+0x110002,
+0x110001,
+0x110000,
+0x200420,
+0xffffffff,
+0xffffffff,
+0x110004,
+0x005080,
+0xffffffff,
+0xffffffff,
+0x110008,
+0xffffffff,
+0x020900,
+0x802010,
+0xffffffff,
+0xffffffff,
+0x408008,
+0x021100,
+0xffffffff,
+0x200410,
+0xffffffff,
+0xffffffff,
+0x004880,
+0x408001,
+0x408000,
+0xffffffff,
+0x408002,
+0xffffffff,
+0x408004,
+0x802020,
+0xffffffff,
+0x200404,
+0xffffffff,
+0xffffffff,
+0x110020,
+0x200400,
+0x200401,
+0x200402,
+0xffffffff,
+0xffffffff,
+0x408010,
+0x0c0800,
+0xffffffff,
+0x200408,
+0xffffffff,
+0xffffffff,
+0x001240,
+0x000a80,
+0xffffffff,
+0xffffffff,
+0x0a0008,
+0xffffffff,
+0x402010,
+0x011400,
+0xffffffff,
+0xffffffff,
+0x0a0002,
+0x0a0001,
+0x0a0000,
+0x040120,
+0xffffffff,
+0xffffffff,
+0x0a0004,
+0xffffffff,
+0x402004,
+0x808020,
+0xffffffff,
+0x402001,
+0x402000,
+0xffffffff,
+0x402002,
+0x005040,
+0xffffffff,
+0xffffffff,
+0x0a0010,
+0xffffffff,
+0x402008,
+0x300800,
+0xffffffff,
+0xffffffff,
+0x301000,
+0x808010,
+0xffffffff,
+0x040108,
+0xffffffff,
+0xffffffff,
+0x004840,
+0x040104,
+0xffffffff,
+0xffffffff,
+0x0a0020,
+0x040100,
+0x040101,
+0x040102,
+0xffffffff,
+0x808002,
+0xffffffff,
+0x808000,
+0x808001,
+0xffffffff,
+0x402020,
+0x808004,
+0xffffffff,
+0xffffffff,
+0x010c00,
+0x808008,
+0xffffffff,
+0x040110,
+0xffffffff,
+0xffffffff,
+0x001280,
+0xffffffff,
+0x800500,
+0x640000,
+0xffffffff,
+0x128000,
+0xffffffff,
+0xffffffff,
+0x004820,
+0x005010,
+0xffffffff,
+0xffffffff,
+0x0a0040,
+0xffffffff,
+0x210200,
+0x802080,
+0xffffffff,
+0x005008,
+0xffffffff,
+0xffffffff,
+0x110080,
+0xffffffff,
+0x402040,
+0x080300,
+0xffffffff,
+0x005000,
+0x005001,
+0x005002,
+0xffffffff,
+0x005004,
+0xffffffff,
+0xffffffff,
+0x048400,
+0x092000,
+0xffffffff,
+0xffffffff,
+0x004804,
+0xffffffff,
+0x004802,
+0x004801,
+0x004800,
+0xffffffff,
+0x408080,
+0x100600,
+0xffffffff,
+0x040140,
+0xffffffff,
+0xffffffff,
+0x004808,
+0xffffffff,
+0x060200,
+0x808040,
+0xffffffff,
+0x200480,
+0xffffffff,
+0xffffffff,
+0x004810,
+0x005020,
+0xffffffff,
+0xffffffff,
+0x202100,
+0xffffffff,
+0x980000,
+0x430000,
+0xffffffff,
+0x000b00,
+0xffffffff,
+0xffffffff,
+0x208004,
+0xffffffff,
+0x208002,
+0x208001,
+0x208000,
+0xffffffff,
+0x013000,
+0x400410,
+0xffffffff,
+0x0400a0,
+0xffffffff,
+0xffffffff,
+0x208008,
+0xffffffff,
+0x084020,
+0x400408,
+0xffffffff,
+0x901000,
+0xffffffff,
+0xffffffff,
+0x208010,
+0x400402,
+0xffffffff,
+0x400400,
+0x400401,
+0xffffffff,
+0x020840,
+0x400404,
+0xffffffff,
+0xffffffff,
+0x084010,
+0x021040,
+0xffffffff,
+0x040088,
+0xffffffff,
+0xffffffff,
+0x208020,
+0x040084,
+0xffffffff,
+0xffffffff,
+0x900800,
+0x040080,
+0x040081,
+0x040082,
+0xffffffff,
+0x084001,
+0x084000,
+0xffffffff,
+0x084002,
+0xffffffff,
+0x084004,
+0x012800,
+0xffffffff,
+0xffffffff,
+0x084008,
+0x400420,
+0xffffffff,
+0x040090,
+0xffffffff,
+0xffffffff,
+0x001300,
+0xffffffff,
+0x800480,
+0x021020,
+0xffffffff,
+0x414000,
+0xffffffff,
+0xffffffff,
+0x208040,
+0x380000,
+0xffffffff,
+0xffffffff,
+0x044200,
+0xffffffff,
+0x020810,
+0x802100,
+0xffffffff,
+0x04a000,
+0xffffffff,
+0xffffffff,
+0x110100,
+0xffffffff,
+0x020808,
+0x080280,
+0xffffffff,
+0xffffffff,
+0x020804,
+0x400440,
+0xffffffff,
+0x020801,
+0x020800,
+0xffffffff,
+0x020802,
+0x021002,
+0xffffffff,
+0x021000,
+0x021001,
+0xffffffff,
+0x102200,
+0x021004,
+0xffffffff,
+0xffffffff,
+0x408100,
+0x021008,
+0xffffffff,
+0x0400c0,
+0xffffffff,
+0xffffffff,
+0x090400,
+0xffffffff,
+0x084040,
+0x021010,
+0xffffffff,
+0x200500,
+0xffffffff,
+0xffffffff,
+0xc40000,
+0x810200,
+0xffffffff,
+0xffffffff,
+0x202080,
+0xffffffff,
+0x020820,
+0x10c000,
+0xffffffff,
+0xffffffff,
+0x800440,
+0x106000,
+0xffffffff,
+0x040028,
+0xffffffff,
+0xffffffff,
+0x208080,
+0x040024,
+0xffffffff,
+0xffffffff,
+0x0a0100,
+0x040020,
+0x040021,
+0x040022,
+0xffffffff,
+0x230000,
+0xffffffff,
+0xffffffff,
+0x041800,
+0xffffffff,
+0x402100,
+0x080240,
+0xffffffff,
+0xffffffff,
+0x108200,
+0x400480,
+0xffffffff,
+0x040030,
+0xffffffff,
+0xffffffff,
+0x814000,
+0x04000c,
+0xffffffff,
+0xffffffff,
+0x410200,
+0x040008,
+0x040009,
+0x04000a,
+0xffffffff,
+0x040004,
+0x040005,
+0x040006,
+0xffffffff,
+0x040000,
+0x040001,
+0x040002,
+0x040003,
+0xffffffff,
+0x084080,
+0x808100,
+0xffffffff,
+0x040018,
+0xffffffff,
+0xffffffff,
+0x120400,
+0x040014,
+0xffffffff,
+0xffffffff,
+0x202040,
+0x040010,
+0x040011,
+0x040012,
+0xffffffff,
+0x800401,
+0x800400,
+0xffffffff,
+0x800402,
+0xffffffff,
+0x800404,
+0x080210,
+0xffffffff,
+0xffffffff,
+0x800408,
+0x018800,
+0xffffffff,
+0x040060,
+0xffffffff,
+0xffffffff,
+0x501000,
+0xffffffff,
+0x800410,
+0x080204,
+0xffffffff,
+0x080202,
+0xffffffff,
+0x080200,
+0x080201,
+0x005100,
+0xffffffff,
+0xffffffff,
+0x202020,
+0xffffffff,
+0x020880,
+0x080208,
+0xffffffff,
+0xffffffff,
+0x800420,
+0x021080,
+0xffffffff,
+0x040048,
+0xffffffff,
+0xffffffff,
+0x004900,
+0x040044,
+0xffffffff,
+0xffffffff,
+0x202010,
+0x040040,
+0x040041,
+0x040042,
+0xffffffff,
+0x500800,
+0xffffffff,
+0xffffffff,
+0x202008,
+0xffffffff,
+0x019000,
+0x080220,
+0xffffffff,
+0xffffffff,
+0x202002,
+0x202001,
+0x202000,
+0x040050,
+0xffffffff,
+0xffffffff,
+0x202004,
+0x000c00,
+0x000c01,
+0x000c02,
+0xffffffff,
+0x000c04,
+0xffffffff,
+0xffffffff,
+0x420040,
+0x000c08,
+0xffffffff,
+0xffffffff,
+0x818000,
+0xffffffff,
+0x104200,
+0x2c0000,
+0xffffffff,
+0x000c10,
+0xffffffff,
+0xffffffff,
+0x204080,
+0xffffffff,
+0x050100,
+0x10a000,
+0xffffffff,
+0xffffffff,
+0x082040,
+0x400300,
+0xffffffff,
+0x820080,
+0xffffffff,
+0xffffffff,
+0x001420,
+0x000c20,
+0xffffffff,
+0xffffffff,
+0x042200,
+0xffffffff,
+0x088080,
+0x804100,
+0xffffffff,
+0xffffffff,
+0x220100,
+0x1000c0,
+0xffffffff,
+0x412000,
+0xffffffff,
+0xffffffff,
+0x001410,
+0xffffffff,
+0xd00000,
+0x0b0000,
+0xffffffff,
+0x200240,
+0xffffffff,
+0xffffffff,
+0x001408,
+0x04c000,
+0xffffffff,
+0xffffffff,
+0x001404,
+0xffffffff,
+0x001402,
+0x001401,
+0x001400,
+0x000c40,
+0xffffffff,
+0xffffffff,
+0x420004,
+0xffffffff,
+0x420002,
+0x420001,
+0x420000,
+0xffffffff,
+0x082010,
+0x1000a0,
+0xffffffff,
+0x009100,
+0xffffffff,
+0xffffffff,
+0x420008,
+0xffffffff,
+0x082008,
+0x841000,
+0xffffffff,
+0x200220,
+0xffffffff,
+0xffffffff,
+0x420010,
+0x082001,
+0x082000,
+0xffffffff,
+0x082002,
+0xffffffff,
+0x082004,
+0x014800,
+0xffffffff,
+0xffffffff,
+0x015000,
+0x100088,
+0xffffffff,
+0x200210,
+0xffffffff,
+0xffffffff,
+0x420020,
+0x100082,
+0xffffffff,
+0x100080,
+0x100081,
+0xffffffff,
+0x840800,
+0x100084,
+0xffffffff,
+0x200204,
+0xffffffff,
+0xffffffff,
+0x008900,
+0x200200,
+0x200201,
+0x200202,
+0xffffffff,
+0xffffffff,
+0x082020,
+0x100090,
+0xffffffff,
+0x200208,
+0xffffffff,
+0xffffffff,
+0x001440,
+0x000c80,
+0xffffffff,
+0xffffffff,
+0x204010,
+0xffffffff,
+0x088020,
+0x011200,
+0xffffffff,
+0xffffffff,
+0x441000,
+0x100060,
+0xffffffff,
+0x820010,
+0xffffffff,
+0xffffffff,
+0x002900,
+0xffffffff,
+0x204002,
+0x204001,
+0x204000,
+0x820008,
+0xffffffff,
+0xffffffff,
+0x204004,
+0x820004,
+0xffffffff,
+0xffffffff,
+0x204008,
+0x820000,
+0x820001,
+0x820002,
+0xffffffff,
+0xffffffff,
+0x088004,
+0x100048,
+0xffffffff,
+0x088001,
+0x088000,
+0xffffffff,
+0x088002,
+0x100042,
+0xffffffff,
+0x100040,
+0x100041,
+0xffffffff,
+0x088008,
+0x100044,
+0xffffffff,
+0x003100,
+0xffffffff,
+0xffffffff,
+0x204020,
+0xffffffff,
+0x088010,
+0x440800,
+0xffffffff,
+0xffffffff,
+0x010a00,
+0x100050,
+0xffffffff,
+0x820020,
+0xffffffff,
+0xffffffff,
+0x001480,
+0xffffffff,
+0x800300,
+0x100028,
+0xffffffff,
+0x046000,
+0xffffffff,
+0xffffffff,
+0x420080,
+0x100022,
+0xffffffff,
+0x100020,
+0x100021,
+0xffffffff,
+0x210400,
+0x100024,
+0xffffffff,
+0x418000,
+0xffffffff,
+0xffffffff,
+0x204040,
+0xffffffff,
+0x101800,
+0x080500,
+0xffffffff,
+0xffffffff,
+0x082080,
+0x100030,
+0xffffffff,
+0x820040,
+0xffffffff,
+0xffffffff,
+0x048200,
+0x10000a,
+0xffffffff,
+0x100008,
+0x100009,
+0xffffffff,
+0x088040,
+0x10000c,
+0xffffffff,
+0x100002,
+0x100003,
+0x100000,
+0x100001,
+0x100006,
+0xffffffff,
+0x100004,
+0x100005,
+0xffffffff,
+0x060400,
+0x100018,
+0xffffffff,
+0x200280,
+0xffffffff,
+0xffffffff,
+0x812000,
+0x100012,
+0xffffffff,
+0x100010,
+0x100011,
+0xffffffff,
+0x404100,
+0x100014,
+0xffffffff,
+0x000d00,
+0xffffffff,
+0xffffffff,
+0x181000,
+0xffffffff,
+0x050010,
+0x804020,
+0xffffffff,
+0xffffffff,
+0x220020,
+0x400210,
+0xffffffff,
+0x009040,
+0xffffffff,
+0xffffffff,
+0x002880,
+0xffffffff,
+0x050004,
+0x400208,
+0xffffffff,
+0x050001,
+0x050000,
+0xffffffff,
+0x050002,
+0x400202,
+0xffffffff,
+0x400200,
+0x400201,
+0xffffffff,
+0x050008,
+0x400204,
+0xffffffff,
+0xffffffff,
+0x220008,
+0x804004,
+0xffffffff,
+0x804002,
+0xffffffff,
+0x804000,
+0x804001,
+0x220001,
+0x220000,
+0xffffffff,
+0x220002,
+0xffffffff,
+0x220004,
+0x804008,
+0xffffffff,
+0x003080,
+0xffffffff,
+0xffffffff,
+0x008840,
+0xffffffff,
+0x050020,
+0x804010,
+0xffffffff,
+0xffffffff,
+0x220010,
+0x400220,
+0xffffffff,
+0x180800,
+0xffffffff,
+0xffffffff,
+0x001500,
+0xffffffff,
+0x800280,
+0x212000,
+0xffffffff,
+0x009008,
+0xffffffff,
+0xffffffff,
+0x420100,
+0x009004,
+0xffffffff,
+0xffffffff,
+0x044400,
+0x009000,
+0x009001,
+0x009002,
+0xffffffff,
+0x124000,
+0xffffffff,
+0xffffffff,
+0x008820,
+0xffffffff,
+0x050040,
+0x080480,
+0xffffffff,
+0xffffffff,
+0x082100,
+0x400240,
+0xffffffff,
+0x009010,
+0xffffffff,
+0xffffffff,
+0xb00000,
+0x4c0000,
+0xffffffff,
+0xffffffff,
+0x008810,
+0xffffffff,
+0x102400,
+0x804040,
+0xffffffff,
+0xffffffff,
+0x220040,
+0x100180,
+0xffffffff,
+0x009020,
+0xffffffff,
+0xffffffff,
+0x090200,
+0xffffffff,
+0x008802,
+0x008801,
+0x008800,
+0x200300,
+0xffffffff,
+0xffffffff,
+0x008804,
+0x810400,
+0xffffffff,
+0xffffffff,
+0x008808,
+0xffffffff,
+0x404080,
+0x062000,
+0xffffffff,
+0xffffffff,
+0x800240,
+0x068000,
+0xffffffff,
+0x700000,
+0xffffffff,
+0xffffffff,
+0x002808,
+0x094000,
+0xffffffff,
+0xffffffff,
+0x002804,
+0xffffffff,
+0x002802,
+0x002801,
+0x002800,
+0x003020,
+0xffffffff,
+0xffffffff,
+0x204100,
+0xffffffff,
+0x050080,
+0x080440,
+0xffffffff,
+0xffffffff,
+0x108400,
+0x400280,
+0xffffffff,
+0x820100,
+0xffffffff,
+0xffffffff,
+0x002810,
+0x003010,
+0xffffffff,
+0xffffffff,
+0x410400,
+0xffffffff,
+0x088100,
+0x804080,
+0xffffffff,
+0xffffffff,
+0x220080,
+0x100140,
+0xffffffff,
+0x040600,
+0xffffffff,
+0xffffffff,
+0x002820,
+0x003000,
+0x003001,
+0x003002,
+0xffffffff,
+0x003004,
+0xffffffff,
+0xffffffff,
+0x120200,
+0x003008,
+0xffffffff,
+0xffffffff,
+0x8c0000,
+0xffffffff,
+0x404040,
+0x218000,
+0xffffffff,
+0x800201,
+0x800200,
+0xffffffff,
+0x800202,
+0xffffffff,
+0x800204,
+0x080410,
+0xffffffff,
+0xffffffff,
+0x800208,
+0x100120,
+0xffffffff,
+0x009080,
+0xffffffff,
+0xffffffff,
+0x002840,
+0xffffffff,
+0x800210,
+0x080404,
+0xffffffff,
+0x080402,
+0xffffffff,
+0x080400,
+0x080401,
+0x240800,
+0xffffffff,
+0xffffffff,
+0x031000,
+0xffffffff,
+0x404020,
+0x080408,
+0xffffffff,
+0xffffffff,
+0x800220,
+0x100108,
+0xffffffff,
+0x030800,
+0xffffffff,
+0xffffffff,
+0x241000,
+0x100102,
+0xffffffff,
+0x100100,
+0x100101,
+0xffffffff,
+0x404010,
+0x100104,
+0xffffffff,
+0x003040,
+0xffffffff,
+0xffffffff,
+0x008880,
+0xffffffff,
+0x404008,
+0x080420,
+0xffffffff,
+0xffffffff,
+0x404004,
+0x100110,
+0xffffffff,
+0x404001,
+0x404000,
+0xffffffff,
+0x404002,
+0x000e00,
+0xffffffff,
+0xffffffff,
+0x042020,
+0xffffffff,
+0x104008,
+0x011080,
+0xffffffff,
+0xffffffff,
+0x104004,
+0x400110,
+0xffffffff,
+0x104001,
+0x104000,
+0xffffffff,
+0x104002,
+0xffffffff,
+0x029000,
+0x400108,
+0xffffffff,
+0x200060,
+0xffffffff,
+0xffffffff,
+0x880800,
+0x400102,
+0xffffffff,
+0x400100,
+0x400101,
+0xffffffff,
+0x104010,
+0x400104,
+0xffffffff,
+0xffffffff,
+0x042002,
+0x042001,
+0x042000,
+0x200050,
+0xffffffff,
+0xffffffff,
+0x042004,
+0x881000,
+0xffffffff,
+0xffffffff,
+0x042008,
+0xffffffff,
+0x104020,
+0x028800,
+0xffffffff,
+0x200044,
+0xffffffff,
+0xffffffff,
+0x042010,
+0x200040,
+0x200041,
+0x200042,
+0xffffffff,
+0xffffffff,
+0x010880,
+0x400120,
+0xffffffff,
+0x200048,
+0xffffffff,
+0xffffffff,
+0x001600,
+0xffffffff,
+0x800180,
+0x08c000,
+0xffffffff,
+0x200030,
+0xffffffff,
+0xffffffff,
+0x420200,
+0x070000,
+0xffffffff,
+0xffffffff,
+0x201800,
+0xffffffff,
+0x104040,
+0x802400,
+0xffffffff,
+0x200024,
+0xffffffff,
+0xffffffff,
+0x110400,
+0x200020,
+0x200021,
+0x200022,
+0xffffffff,
+0xffffffff,
+0x082200,
+0x400140,
+0xffffffff,
+0x200028,
+0xffffffff,
+0xffffffff,
+0x048080,
+0x200014,
+0xffffffff,
+0xffffffff,
+0x042040,
+0x200010,
+0x200011,
+0x200012,
+0xffffffff,
+0xffffffff,
+0x408400,
+0x100280,
+0xffffffff,
+0x200018,
+0xffffffff,
+0xffffffff,
+0x090100,
+0x200004,
+0x200005,
+0x200006,
+0xffffffff,
+0x200000,
+0x200001,
+0x200002,
+0x200003,
+0x20000c,
+0xffffffff,
+0xffffffff,
+0x824000,
+0x200008,
+0x200009,
+0x20000a,
+0xffffffff,
+0xffffffff,
+0x800140,
+0x011004,
+0xffffffff,
+0x011002,
+0xffffffff,
+0x011000,
+0x011001,
+0x20a000,
+0xffffffff,
+0xffffffff,
+0x0a0400,
+0xffffffff,
+0x104080,
+0x011008,
+0xffffffff,
+0x1c0000,
+0xffffffff,
+0xffffffff,
+0x204200,
+0xffffffff,
+0x402400,
+0x011010,
+0xffffffff,
+0xffffffff,
+0x010820,
+0x400180,
+0xffffffff,
+0x820200,
+0xffffffff,
+0xffffffff,
+0x048040,
+0x424000,
+0xffffffff,
+0xffffffff,
+0x042080,
+0xffffffff,
+0x088200,
+0x011020,
+0xffffffff,
+0xffffffff,
+0x010810,
+0x100240,
+0xffffffff,
+0x040500,
+0xffffffff,
+0xffffffff,
+0xe00000,
+0xffffffff,
+0x010808,
+0x808400,
+0xffffffff,
+0x2000c0,
+0xffffffff,
+0xffffffff,
+0x120100,
+0x010801,
+0x010800,
+0xffffffff,
+0x010802,
+0xffffffff,
+0x010804,
+0x086000,
+0xffffffff,
+0x800101,
+0x800100,
+0xffffffff,
+0x800102,
+0xffffffff,
+0x800104,
+0x011040,
+0xffffffff,
+0xffffffff,
+0x800108,
+0x100220,
+0xffffffff,
+0x480800,
+0xffffffff,
+0xffffffff,
+0x048010,
+0xffffffff,
+0x800110,
+0x022800,
+0xffffffff,
+0x2000a0,
+0xffffffff,
+0xffffffff,
+0x048008,
+0x005400,
+0xffffffff,
+0xffffffff,
+0x048004,
+0xffffffff,
+0x048002,
+0x048001,
+0x048000,
+0xffffffff,
+0x800120,
+0x100208,
+0xffffffff,
+0x200090,
+0xffffffff,
+0xffffffff,
+0x004c00,
+0x100202,
+0xffffffff,
+0x100200,
+0x100201,
+0xffffffff,
+0x023000,
+0x100204,
+0xffffffff,
+0x200084,
+0xffffffff,
+0xffffffff,
+0x481000,
+0x200080,
+0x200081,
+0x200082,
+0xffffffff,
+0xffffffff,
+0x010840,
+0x100210,
+0xffffffff,
+0x200088,
+0xffffffff,
+0xffffffff,
+0x048020,
+0xffffffff,
+0x8000c0,
+0x400018,
+0xffffffff,
+0x0a2000,
+0xffffffff,
+0xffffffff,
+0x208400,
+0x400012,
+0xffffffff,
+0x400010,
+0x400011,
+0xffffffff,
+0x104100,
+0x400014,
+0xffffffff,
+0x40000a,
+0xffffffff,
+0x400008,
+0x400009,
+0xffffffff,
+0x050200,
+0x40000c,
+0xffffffff,
+0x400002,
+0x400003,
+0x400000,
+0x400001,
+0x400006,
+0xffffffff,
+0x400004,
+0x400005,
+0x118000,
+0xffffffff,
+0xffffffff,
+0x042100,
+0xffffffff,
+0x401800,
+0x804200,
+0xffffffff,
+0xffffffff,
+0x220200,
+0x400030,
+0xffffffff,
+0x040480,
+0xffffffff,
+0xffffffff,
+0x090040,
+0xffffffff,
+0x084400,
+0x400028,
+0xffffffff,
+0x200140,
+0xffffffff,
+0xffffffff,
+0x120080,
+0x400022,
+0xffffffff,
+0x400020,
+0x400021,
+0xffffffff,
+0x80a000,
+0x400024,
+0xffffffff,
+0x800081,
+0x800080,
+0xffffffff,
+0x800082,
+0xffffffff,
+0x800084,
+0x140800,
+0xffffffff,
+0xffffffff,
+0x800088,
+0x400050,
+0xffffffff,
+0x009200,
+0xffffffff,
+0xffffffff,
+0x090020,
+0xffffffff,
+0x800090,
+0x400048,
+0xffffffff,
+0x200120,
+0xffffffff,
+0xffffffff,
+0x007000,
+0x400042,
+0xffffffff,
+0x400040,
+0x400041,
+0xffffffff,
+0x020c00,
+0x400044,
+0xffffffff,
+0xffffffff,
+0x8000a0,
+0x021400,
+0xffffffff,
+0x200110,
+0xffffffff,
+0xffffffff,
+0x090008,
+0x006800,
+0xffffffff,
+0xffffffff,
+0x090004,
+0xffffffff,
+0x090002,
+0x090001,
+0x090000,
+0x200104,
+0xffffffff,
+0xffffffff,
+0x008a00,
+0x200100,
+0x200101,
+0x200102,
+0xffffffff,
+0xffffffff,
+0x141000,
+0x400060,
+0xffffffff,
+0x200108,
+0xffffffff,
+0xffffffff,
+0x090010,
+0x800041,
+0x800040,
+0xffffffff,
+0x800042,
+0xffffffff,
+0x800044,
+0x011100,
+0xffffffff,
+0xffffffff,
+0x800048,
+0x400090,
+0xffffffff,
+0x040420,
+0xffffffff,
+0xffffffff,
+0x002a00,
+0xffffffff,
+0x800050,
+0x400088,
+0xffffffff,
+0x00c800,
+0xffffffff,
+0xffffffff,
+0x120020,
+0x400082,
+0xffffffff,
+0x400080,
+0x400081,
+0xffffffff,
+0x281000,
+0x400084,
+0xffffffff,
+0xffffffff,
+0x800060,
+0x280800,
+0xffffffff,
+0x040408,
+0xffffffff,
+0xffffffff,
+0x120010,
+0x040404,
+0xffffffff,
+0xffffffff,
+0x00d000,
+0x040400,
+0x040401,
+0x040402,
+0xffffffff,
+0x003200,
+0xffffffff,
+0xffffffff,
+0x120004,
+0xffffffff,
+0x120002,
+0x120001,
+0x120000,
+0xffffffff,
+0x010900,
+0x4000a0,
+0xffffffff,
+0x040410,
+0xffffffff,
+0xffffffff,
+0x120008,
+0x800001,
+0x800000,
+0x800003,
+0x800002,
+0x800005,
+0x800004,
+0xffffffff,
+0x800006,
+0x800009,
+0x800008,
+0xffffffff,
+0x80000a,
+0xffffffff,
+0x80000c,
+0x224000,
+0xffffffff,
+0x800011,
+0x800010,
+0xffffffff,
+0x800012,
+0xffffffff,
+0x800014,
+0x080600,
+0xffffffff,
+0xffffffff,
+0x800018,
+0x4000c0,
+0xffffffff,
+0x112000,
+0xffffffff,
+0xffffffff,
+0x048100,
+0x800021,
+0x800020,
+0xffffffff,
+0x800022,
+0xffffffff,
+0x800024,
+0x40a000,
+0xffffffff,
+0xffffffff,
+0x800028,
+0x100300,
+0xffffffff,
+0x040440,
+0xffffffff,
+0xffffffff,
+0x090080,
+0xffffffff,
+0x800030,
+0x054000,
+0xffffffff,
+0x200180,
+0xffffffff,
+0xffffffff,
+0x120040,
+0x0a8000,
+0xffffffff,
+0xffffffff,
+0x202400,
+0xffffffff,
+0x404200,
+0x801800,
+0xffffffff
+};